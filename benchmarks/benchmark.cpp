@@ -0,0 +1,280 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <fstream>
+#include <cstdio>
+#include <filesystem>
+#include "memory_resource.h"
+#include "huge_page_resource.h"
+#include "dynamic_array.h"
+#include "concurrent_dynamic_array.h"
+#include "compressed_int_array.h"
+#include "chunked_loader.h"
+#include "cow_dynamic_array.h"
+
+using bench_clock = std::chrono::steady_clock;
+
+double elapsed_ms(bench_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(bench_clock::now() - start).count();
+}
+
+void print_result(const std::string& name, std::size_t operations, double ms) {
+    std::cout << name << ": " << ms << " ms, "
+              << (operations / ms / 1000.0) << " Mops/s" << std::endl;
+}
+
+void bench_concurrent_append(unsigned threads, std::size_t per_thread) {
+    std::cout << "=== CONCURRENT APPEND (" << threads << " threads x "
+              << per_thread << " ints) ===" << std::endl;
+
+    const std::size_t total = threads * per_thread;
+
+    // Базовый вариант: dynamic_array под общим мьютексом
+    {
+        dynamic_array<int> arr;
+        std::mutex arr_mutex;
+        std::vector<std::thread> workers;
+
+        auto start = bench_clock::now();
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                for (std::size_t i = 0; i < per_thread; ++i) {
+                    std::lock_guard<std::mutex> lock(arr_mutex);
+                    arr.push_back(static_cast<int>(t * per_thread + i));
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        print_result("mutex + dynamic_array", total, elapsed_ms(start));
+    }
+
+    // Атомарное резервирование слотов и сегментный рост
+    {
+        concurrent_dynamic_array<int> arr;
+        std::vector<std::thread> workers;
+
+        auto start = bench_clock::now();
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                for (std::size_t i = 0; i < per_thread; ++i) {
+                    arr.push_back(static_cast<int>(t * per_thread + i));
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        print_result("concurrent_dynamic_array", total, elapsed_ms(start));
+    }
+}
+
+// Случайные чтения по большому массиву: почти каждое обращение попадает
+// на новую страницу, поэтому время определяется промахами TLB
+double random_gather_ms(std::pmr::memory_resource* upstream, std::size_t elements, std::size_t reads) {
+    dynamic_memory_resource mr(upstream);
+    dynamic_array<int> arr(elements, &mr);
+    for (std::size_t i = 0; i < elements; ++i) {
+        arr[i] = static_cast<int>(i);
+    }
+
+    std::uint64_t state = 88172645463325252ull;
+    long long sum = 0;
+    auto start = bench_clock::now();
+    for (std::size_t i = 0; i < reads; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        sum += arr[state % elements];
+    }
+    double ms = elapsed_ms(start);
+    std::cout << "checksum: " << sum << std::endl;
+    return ms;
+}
+
+void bench_huge_pages(std::size_t elements, std::size_t reads) {
+    std::cout << "\n=== RANDOM GATHER (" << elements << " ints, "
+              << reads << " reads) ===" << std::endl;
+
+    std::ifstream thp("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string thp_mode;
+    if (std::getline(thp, thp_mode)) {
+        std::cout << "transparent_hugepage: " << thp_mode << std::endl;
+    }
+
+    double regular = random_gather_ms(std::pmr::new_delete_resource(), elements, reads);
+    print_result("operator new upstream", reads, regular);
+
+    huge_page_resource huge_pages;
+    double huge = random_gather_ms(&huge_pages, elements, reads);
+    print_result("huge_page_resource upstream", reads, huge);
+}
+
+// Создание большого буфера double, который затем целиком перезаписывается
+void bench_sizing(std::size_t elements) {
+    std::cout << "\n=== SIZING SCRATCH BUFFER (" << elements << " doubles) ===" << std::endl;
+
+    auto run = [elements](const std::string& name, auto make) {
+        auto start = bench_clock::now();
+        auto arr = make();
+        for (std::size_t i = 0; i < elements; ++i) {
+            arr[i] = static_cast<double>(i);
+        }
+        double ms = elapsed_ms(start);
+        std::cout << "checksum: " << arr[elements - 1] << std::endl;
+        print_result(name, elements, ms);
+    };
+
+    run("value-init constructor + overwrite", [elements] {
+        return dynamic_array<double>(elements);
+    });
+    run("default_init constructor + overwrite", [elements] {
+        return dynamic_array<double>(elements, default_init);
+    });
+    run("fill constructor + overwrite", [elements] {
+        return dynamic_array<double>(elements, 1.0);
+    });
+}
+
+// Полный скан колонки: сырой массив против сжатого с поблочным декодированием
+void bench_compressed_scan(std::size_t elements, int passes) {
+    std::cout << "\n=== COLUMN SCAN (" << elements << " ints, "
+              << passes << " passes) ===" << std::endl;
+
+    // Отсортированные идентификаторы с небольшими шагами
+    dynamic_array<int> values(elements, default_init);
+    std::uint32_t state = 12345;
+    int current = 0;
+    for (std::size_t i = 0; i < elements; ++i) {
+        state = state * 1664525u + 1013904223u;
+        current += static_cast<int>(state >> 28);
+        values[i] = current;
+    }
+
+    compressed_int_array packed(values);
+    std::cout << "raw: " << (elements * sizeof(int) >> 20) << " MB, compressed: "
+              << (packed.memory_bytes() >> 20) << " MB" << std::endl;
+
+    auto start = bench_clock::now();
+    long long sum = 0;
+    for (int pass = 0; pass < passes; ++pass) {
+        for (std::size_t i = 0; i < elements; ++i) {
+            sum += values[i];
+        }
+    }
+    double raw = elapsed_ms(start);
+    std::cout << "checksum: " << sum << std::endl;
+    print_result("dynamic_array<int> scan", elements * passes, raw);
+
+    start = bench_clock::now();
+    sum = 0;
+    int block[compressed_int_array::block_size];
+    for (int pass = 0; pass < passes; ++pass) {
+        for (std::size_t b = 0; b < packed.block_count(); ++b) {
+            std::size_t count = packed.decode_block(b, block);
+            for (std::size_t i = 0; i < count; ++i) {
+                sum += block[i];
+            }
+        }
+    }
+    double compressed = elapsed_ms(start);
+    std::cout << "checksum: " << sum << std::endl;
+    print_result("compressed_int_array scan", elements * passes, compressed);
+}
+
+// Загрузка TestStruct из файла: последовательно и с перекрытием
+// чтения/разбора
+void bench_chunked_load(std::size_t records) {
+    std::cout << "\n=== CHUNKED LOAD (" << records << " records) ===" << std::endl;
+
+    std::string path = (std::filesystem::temp_directory_path() / "benchmark_records.txt").string();
+    {
+        dynamic_array<TestStruct> items;
+        items.reserve(records);
+        for (std::size_t i = 0; i < records; ++i) {
+            items.push_back(TestStruct(static_cast<int>(i), i * 0.25, "record_" + std::to_string(i)));
+        }
+        save_test_structs(path, items);
+    }
+
+    auto run = [&path](const std::string& name, auto load) {
+        auto start = bench_clock::now();
+        dynamic_array<TestStruct> loaded;
+        std::size_t count = load(loaded);
+        double ms = elapsed_ms(start);
+        std::cout << "last id: " << loaded[count - 1].id << std::endl;
+        print_result(name, count, ms);
+    };
+
+    run("serial load", [&path](dynamic_array<TestStruct>& out) {
+        return load_test_structs_serial(path, out);
+    });
+    run("pipelined load", [&path](dynamic_array<TestStruct>& out) {
+        return load_test_structs(path, out);
+    });
+
+    std::remove(path.c_str());
+}
+
+// Версия для читателя: полная копия массива против O(1) снимка, после
+// каждой версии писатель меняет один элемент
+void bench_snapshots(std::size_t elements, std::size_t versions) {
+    std::cout << "\n=== READER SNAPSHOTS (" << elements << " ints, "
+              << versions << " versions) ===" << std::endl;
+
+    dynamic_array<int> plain;
+    cow_dynamic_array<int> cow;
+    for (std::size_t i = 0; i < elements; ++i) {
+        plain.push_back(static_cast<int>(i));
+        cow.push_back(static_cast<int>(i));
+    }
+
+    auto start = bench_clock::now();
+    long long sum = 0;
+    for (std::size_t v = 0; v < versions; ++v) {
+        dynamic_array<int> copy;
+        copy.reserve(plain.size());
+        for (int value : plain) {
+            copy.push_back(value);
+        }
+        sum += copy[v % elements];
+        plain[(v * 7919) % elements] += 1;
+    }
+    double copying = elapsed_ms(start);
+    std::cout << "checksum: " << sum << std::endl;
+    print_result("full copy per version", versions, copying);
+
+    start = bench_clock::now();
+    sum = 0;
+    for (std::size_t v = 0; v < versions; ++v) {
+        auto snap = cow.take_snapshot();
+        sum += snap[v % elements];
+        cow.modify((v * 7919) % elements) += 1;
+    }
+    double snapshots = elapsed_ms(start);
+    std::cout << "checksum: " << sum << std::endl;
+    print_result("cow snapshot per version", versions, snapshots);
+}
+
+int main(int argc, char** argv) {
+    unsigned threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 4;
+    std::size_t per_thread = 1000000;
+
+    if (argc > 1) threads = static_cast<unsigned>(std::atoi(argv[1]));
+    if (argc > 2) per_thread = static_cast<std::size_t>(std::atoll(argv[2]));
+
+    bench_concurrent_append(threads, per_thread);
+    bench_huge_pages(std::size_t(64) << 20, 20000000);
+    bench_sizing(std::size_t(64) << 20);
+    bench_compressed_scan(std::size_t(64) << 20, 5);
+    bench_chunked_load(std::size_t(4) << 20);
+    bench_snapshots(std::size_t(1) << 20, 1000);
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include "allocation_profiler.h"
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#include <cxxabi.h>
+#endif
+
+static std::vector<const char*>& tag_stack() {
+    static thread_local std::vector<const char*> tags;
+    return tags;
+}
+
+allocation_tag::allocation_tag(const char* name) {
+    tag_stack().push_back(name);
+}
+
+allocation_tag::~allocation_tag() {
+    tag_stack().pop_back();
+}
+
+#if defined(__GLIBC__)
+// "./app(_ZN3fooEv+0x1c) [0x...]" -> "foo()"
+// Для кадров без символа: "./app(+0x1c23) [0x...]" -> "app+0x1c23"
+// (смещение в модуле, переводится в строку через addr2line -e app),
+// а без модуля - сырой адрес "0x...", чтобы разные места не сливались
+static std::string frame_name(const char* symbol) {
+    std::string text(symbol);
+    std::size_t open = text.find('(');
+    std::size_t plus = text.find('+', open);
+    if (open == std::string::npos || plus == std::string::npos || plus == open + 1) {
+        std::size_t close = text.find(')', open);
+        if (open != std::string::npos && plus == open + 1 && close != std::string::npos) {
+            std::string module = text.substr(0, open);
+            std::size_t slash = module.find_last_of('/');
+            if (slash != std::string::npos) module.erase(0, slash + 1);
+            return module + text.substr(plus, close - plus);
+        }
+        std::size_t bracket = text.find("[0x");
+        if (bracket != std::string::npos) {
+            return text.substr(bracket + 1, text.find(']', bracket) - bracket - 1);
+        }
+        return "[unknown]";
+    }
+
+    std::string mangled = text.substr(open + 1, plus - open - 1);
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(mangled.c_str(), nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        std::string name(demangled);
+        std::free(demangled);
+        return name;
+    }
+    return mangled;
+}
+
+// Кадры самого профилировщика и ресурса, которые стоят в вершине стека.
+// Их число зависит от встраивания, поэтому узнаем их по имени
+static bool is_profiler_frame(const std::string& name) {
+    static const char* const prefixes[] = {
+        "allocation_profiler::",
+        "dynamic_memory_resource::",
+        "std::pmr::memory_resource::",
+    };
+    for (const char* prefix : prefixes) {
+        if (name.compare(0, std::strlen(prefix), prefix) == 0) return true;
+    }
+    return false;
+}
+#endif
+
+std::string allocation_profiler::current_site() {
+    const auto& tags = tag_stack();
+    if (!tags.empty()) {
+        std::string site;
+        for (const char* tag : tags) {
+            if (!site.empty()) site += ';';
+            site += tag;
+        }
+        return site;
+    }
+
+#if defined(__GLIBC__)
+    constexpr int max_depth = 32;
+    void* frames[max_depth];
+    int depth = backtrace(frames, max_depth);
+    char** symbols = backtrace_symbols(frames, depth);
+    if (!symbols) {
+        return "[unknown]";
+    }
+
+    std::string names[max_depth];
+    for (int i = 0; i < depth; ++i) {
+        names[i] = frame_name(symbols[i]);
+    }
+    std::free(symbols);
+
+    // Пропускаем кадры профилировщика и memory_resource в вершине стека
+    int skipped = 0;
+    while (skipped < depth && is_profiler_frame(names[skipped])) {
+        ++skipped;
+    }
+
+    std::string site;
+    for (int i = depth - 1; i >= skipped; --i) {
+        if (!site.empty()) site += ';';
+        site += names[i];
+    }
+    return site.empty() ? "[unknown]" : site;
+#else
+    return "[unknown]";
+#endif
+}
+
+allocation_profiler::allocation_profiler(std::size_t sample_interval)
+    : sample_interval_(sample_interval ? sample_interval : 1),
+      bytes_until_sample_(sample_interval_) {}
+
+void allocation_profiler::on_allocate(void* p, std::size_t bytes) {
+    if (bytes < bytes_until_sample_) {
+        bytes_until_sample_ -= bytes;
+        return;
+    }
+
+    // Выделение пересекло одну или несколько границ сэмплирования;
+    // каждый сэмпл представляет sample_interval байт
+    std::size_t over = bytes - bytes_until_sample_;
+    std::size_t samples = 1 + over / sample_interval_;
+    bytes_until_sample_ = sample_interval_ - over % sample_interval_;
+
+    sample s{current_site(), samples * sample_interval_};
+    live_bytes_[s.site] += s.weight;
+    live_samples_[p] = std::move(s);
+}
+
+void allocation_profiler::on_deallocate(void* p) {
+    auto it = live_samples_.find(p);
+    if (it == live_samples_.end()) return;
+
+    auto site = live_bytes_.find(it->second.site);
+    site->second -= it->second.weight;
+    if (site->second == 0) {
+        live_bytes_.erase(site);
+    }
+    live_samples_.erase(it);
+}
+
+std::size_t allocation_profiler::sample_interval() const {
+    return sample_interval_;
+}
+
+std::size_t allocation_profiler::live_bytes(const std::string& site) const {
+    auto it = live_bytes_.find(site);
+    return it == live_bytes_.end() ? 0 : it->second;
+}
+
+std::size_t allocation_profiler::total_live_bytes() const {
+    std::size_t total = 0;
+    for (const auto& entry : live_bytes_) {
+        total += entry.second;
+    }
+    return total;
+}
+
+void allocation_profiler::write_folded(std::ostream& os) const {
+    for (const auto& entry : live_bytes_) {
+        os << entry.first << ' ' << entry.second << '\n';
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <ostream>
+
+// Сэмплирующий профилировщик мест выделения памяти.
+// Запоминает место (стек вызовов или пользовательский тег) примерно
+// для каждого sample_interval-го выделенного байта и суммирует живые
+// байты по местам. Вывод в формате folded stacks для flamegraph.pl.
+class allocation_profiler {
+private:
+    struct sample {
+        std::string site;
+        std::size_t weight;
+    };
+
+    std::size_t sample_interval_;
+    std::size_t bytes_until_sample_;
+    std::unordered_map<void*, sample> live_samples_;
+    std::map<std::string, std::size_t> live_bytes_;
+
+    static std::string current_site();
+
+public:
+    explicit allocation_profiler(std::size_t sample_interval);
+
+    void on_allocate(void* p, std::size_t bytes);
+    void on_deallocate(void* p);
+
+    std::size_t sample_interval() const;
+
+    // Оценка живых байт для места (frames через ';', от корня к листу)
+    std::size_t live_bytes(const std::string& site) const;
+    std::size_t total_live_bytes() const;
+
+    // Строки вида "frame1;frame2;frame3 bytes"
+    void write_folded(std::ostream& os) const;
+};
+
+// RAII-тег места выделения для текущего потока. Вложенные теги образуют
+// стек "outer;inner". Если тегов нет, записывается стек вызовов.
+// Строка тега должна жить дольше объекта (литерал, typeid(T).name()).
+class allocation_tag {
+public:
+    explicit allocation_tag(const char* name);
+    ~allocation_tag();
+
+    allocation_tag(const allocation_tag&) = delete;
+    allocation_tag& operator=(const allocation_tag&) = delete;
+};
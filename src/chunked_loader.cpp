@@ -0,0 +1,149 @@
+#include "chunked_loader.h"
+#include <fstream>
+#include <future>
+#include <deque>
+#include <limits>
+#include <iomanip>
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+
+// Читает файл кусками примерно по chunk_bytes, каждый кусок кончается
+// на границе строки; неполная строка переносится в следующий кусок
+class chunk_reader {
+private:
+    std::ifstream in_;
+    std::size_t chunk_bytes_;
+    std::string carry_;
+
+public:
+    chunk_reader(const std::string& path, std::size_t chunk_bytes)
+        : in_(path, std::ios::binary), chunk_bytes_(std::max<std::size_t>(chunk_bytes, 1)) {
+        if (!in_) {
+            throw std::runtime_error("cannot open " + path);
+        }
+    }
+
+    bool next(std::string& chunk) {
+        chunk.swap(carry_);
+        carry_.clear();
+        while (in_) {
+            std::size_t old = chunk.size();
+            chunk.resize(old + chunk_bytes_);
+            in_.read(&chunk[old], static_cast<std::streamsize>(chunk_bytes_));
+            chunk.resize(old + static_cast<std::size_t>(in_.gcount()));
+
+            std::size_t last = chunk.rfind('\n');
+            if (in_ && last != std::string::npos) {
+                carry_.assign(chunk, last + 1, std::string::npos);
+                chunk.resize(last + 1);
+                break;
+            }
+        }
+        return !chunk.empty();
+    }
+};
+
+static dynamic_array<TestStruct> parse_chunk(const std::string& text) {
+    dynamic_array<TestStruct> items;
+    items.reserve(static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')) + 1);
+
+    const char* p = text.c_str();
+    const char* end = p + text.size();
+    while (p < end) {
+        const char* eol = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+        if (!eol) eol = end;
+
+        const char* line_end = eol;
+        if (line_end > p && line_end[-1] == '\r') --line_end;
+
+        if (line_end > p) {
+            char* next = nullptr;
+            long id = std::strtol(p, &next, 10);
+            if (next == p || next > line_end) {
+                throw std::runtime_error("malformed record: " + std::string(p, line_end));
+            }
+
+            const char* q = next;
+            double value = std::strtod(q, &next);
+            if (next == q || next > line_end) {
+                throw std::runtime_error("malformed record: " + std::string(p, line_end));
+            }
+
+            q = next;
+            if (q < line_end && *q == ' ') ++q;
+            items.push_back(TestStruct(static_cast<int>(id), value, std::string(q, line_end)));
+        }
+        p = eol + 1;
+    }
+    return items;
+}
+
+// Пакетное добавление: одно резервирование на чанк (с геометрическим
+// ростом, чтобы не копировать весь массив на каждом чанке) и перемещение
+static std::size_t append_chunk(dynamic_array<TestStruct>& out, dynamic_array<TestStruct>& items) {
+    std::size_t needed = out.size() + items.size();
+    if (needed > out.capacity()) {
+        out.reserve(std::max(needed, out.capacity() * 2));
+    }
+    for (auto& item : items) {
+        out.push_back(std::move(item));
+    }
+    return items.size();
+}
+
+std::size_t load_test_structs(const std::string& path, dynamic_array<TestStruct>& out,
+                              const load_options& options) {
+    chunk_reader reader(path, options.chunk_bytes);
+    std::deque<std::future<dynamic_array<TestStruct>>> pending;
+    std::size_t loaded = 0;
+
+    auto append_oldest = [&] {
+        dynamic_array<TestStruct> items = pending.front().get();
+        pending.pop_front();
+        loaded += append_chunk(out, items);
+    };
+
+    std::string chunk;
+    while (reader.next(chunk)) {
+        pending.push_back(std::async(std::launch::async, [text = std::move(chunk)] {
+            return parse_chunk(text);
+        }));
+        chunk = std::string();
+
+        if (pending.size() > options.readahead) {
+            append_oldest();
+        }
+    }
+    while (!pending.empty()) {
+        append_oldest();
+    }
+    return loaded;
+}
+
+std::size_t load_test_structs_serial(const std::string& path, dynamic_array<TestStruct>& out,
+                                     const load_options& options) {
+    chunk_reader reader(path, options.chunk_bytes);
+    std::size_t loaded = 0;
+
+    std::string chunk;
+    while (reader.next(chunk)) {
+        dynamic_array<TestStruct> items = parse_chunk(chunk);
+        loaded += append_chunk(out, items);
+    }
+    return loaded;
+}
+
+void save_test_structs(const std::string& path, const dynamic_array<TestStruct>& items) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("cannot open " + path);
+    }
+
+    // Точность, при которой double читается обратно без потерь
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& item : items) {
+        file << item.id << ' ' << item.value << ' ' << item.name << '\n';
+    }
+}
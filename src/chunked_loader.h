@@ -0,0 +1,32 @@
+#pragma once
+#include <string>
+#include <cstddef>
+#include "dynamic_array.h"
+#include "test_struct.h"
+
+// Загрузка dynamic_array<TestStruct> из текстового файла, одна запись
+// на строку: "id value name" (name - остаток строки, может содержать
+// пробелы). Формат записывает save_test_structs().
+
+struct load_options {
+    std::size_t chunk_bytes = std::size_t(1) << 20;
+    // Сколько прочитанных чанков может разбираться, пока основной поток
+    // читает следующий
+    std::size_t readahead = 2;
+};
+
+// Конвейер: основной поток читает файл чанками по границам строк,
+// каждый чанк разбирается через std::async на рабочем потоке, готовые
+// чанки по порядку дописываются в out пакетно (reserve + перемещение).
+// Чанки разбираются в массивы на ресурсе по умолчанию, поэтому ресурс
+// out не обязан быть потокобезопасным. Возвращает число загруженных
+// записей; при ошибке открытия или разбора бросает std::runtime_error.
+std::size_t load_test_structs(const std::string& path, dynamic_array<TestStruct>& out,
+                              const load_options& options = load_options());
+
+// Последовательный вариант (чтение, разбор, добавление по очереди)
+std::size_t load_test_structs_serial(const std::string& path, dynamic_array<TestStruct>& out,
+                                     const load_options& options = load_options());
+
+// Записывает массив в формате, понятном загрузчикам
+void save_test_structs(const std::string& path, const dynamic_array<TestStruct>& items);
@@ -0,0 +1,256 @@
+#include "compressed_int_array.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define COMPRESSED_INT_SSE2 1
+#endif
+
+static constexpr std::size_t lanes = 4;
+static constexpr std::size_t values_per_lane = compressed_int_array::block_size / lanes;
+
+static std::uint8_t bit_width(std::uint32_t value) {
+    std::uint8_t bits = 0;
+    while (value) {
+        ++bits;
+        value >>= 1;
+    }
+    return bits;
+}
+
+static std::uint32_t low_mask(std::uint8_t bits) {
+    return bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1;
+}
+
+// Значение i блока лежит в дорожке i % 4 на позиции i / 4; слово w
+// дорожки j хранится в words[w * 4 + j]
+static void pack_block(const std::uint32_t* values, std::uint8_t bits, std::uint32_t* words) {
+    for (std::size_t k = 0; k < values_per_lane; ++k) {
+        std::size_t position = k * bits;
+        std::size_t word = position / 32;
+        std::size_t shift = position % 32;
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            std::uint32_t value = values[k * lanes + lane];
+            words[word * lanes + lane] |= value << shift;
+            if (shift + bits > 32) {
+                words[(word + 1) * lanes + lane] |= value >> (32 - shift);
+            }
+        }
+    }
+}
+
+static void unpack_block(const std::uint32_t* words, std::uint8_t bits, std::uint32_t* out) {
+#if defined(COMPRESSED_INT_SSE2)
+    const __m128i mask = _mm_set1_epi32(static_cast<int>(low_mask(bits)));
+    for (std::size_t k = 0; k < values_per_lane; ++k) {
+        std::size_t position = k * bits;
+        std::size_t word = position / 32;
+        std::size_t shift = position % 32;
+
+        __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + word * lanes));
+        __m128i value = _mm_srl_epi32(current, _mm_cvtsi32_si128(static_cast<int>(shift)));
+        if (shift + bits > 32) {
+            __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + (word + 1) * lanes));
+            value = _mm_or_si128(value, _mm_sll_epi32(next, _mm_cvtsi32_si128(static_cast<int>(32 - shift))));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k * lanes), _mm_and_si128(value, mask));
+    }
+#else
+    const std::uint32_t mask = low_mask(bits);
+    for (std::size_t k = 0; k < values_per_lane; ++k) {
+        std::size_t position = k * bits;
+        std::size_t word = position / 32;
+        std::size_t shift = position % 32;
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            std::uint32_t value = words[word * lanes + lane] >> shift;
+            if (shift + bits > 32) {
+                value |= words[(word + 1) * lanes + lane] << (32 - shift);
+            }
+            out[k * lanes + lane] = value & mask;
+        }
+    }
+#endif
+}
+
+static void add_base(std::uint32_t* values, std::uint32_t base) {
+#if defined(COMPRESSED_INT_SSE2)
+    const __m128i offset = _mm_set1_epi32(static_cast<int>(base));
+    for (std::size_t i = 0; i < compressed_int_array::block_size; i += lanes) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), _mm_add_epi32(v, offset));
+    }
+#else
+    for (std::size_t i = 0; i < compressed_int_array::block_size; ++i) {
+        values[i] += base;
+    }
+#endif
+}
+
+static void prefix_sum(std::uint32_t* values, std::uint32_t base) {
+#if defined(COMPRESSED_INT_SSE2)
+    // Префиксная сумма внутри вектора из 4 значений плюс перенос
+    __m128i carry = _mm_set1_epi32(static_cast<int>(base));
+    for (std::size_t i = 0; i < compressed_int_array::block_size; i += lanes) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+        v = _mm_add_epi32(v, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), v);
+        carry = _mm_shuffle_epi32(v, 0xFF);
+    }
+#else
+    std::uint32_t sum = base;
+    for (std::size_t i = 0; i < compressed_int_array::block_size; ++i) {
+        sum += values[i];
+        values[i] = sum;
+    }
+#endif
+}
+
+compressed_int_array::compressed_int_array(const dynamic_array<int>& source, std::pmr::memory_resource* mr)
+    : blocks_(mr), words_(mr), size_(source.size()) {
+    blocks_.reserve((size_ + block_size - 1) / block_size);
+
+    int buffer[block_size];
+    for (std::size_t start = 0; start < size_; start += block_size) {
+        std::size_t count = std::min(block_size, size_ - start);
+        for (std::size_t i = 0; i < count; ++i) {
+            buffer[i] = source[start + i];
+        }
+        encode_block(buffer, count);
+    }
+}
+
+void compressed_int_array::encode_block(const int* values, std::size_t count) {
+    // Неполный последний блок дополняется последним значением: это не
+    // расширяет диапазон и сохраняет монотонность
+    std::int32_t padded[block_size];
+    std::copy(values, values + count, padded);
+    std::fill(padded + count, padded + block_size, values[count - 1]);
+
+    std::int32_t min_value = *std::min_element(padded, padded + block_size);
+    std::uint32_t max_offset = 0;
+    std::uint32_t max_delta = 0;
+    bool sorted = true;
+    for (std::size_t i = 0; i < block_size; ++i) {
+        max_offset = std::max(max_offset, static_cast<std::uint32_t>(padded[i]) - static_cast<std::uint32_t>(min_value));
+        if (i > 0) {
+            if (padded[i] < padded[i - 1]) {
+                sorted = false;
+            } else {
+                max_delta = std::max(max_delta, static_cast<std::uint32_t>(padded[i]) - static_cast<std::uint32_t>(padded[i - 1]));
+            }
+        }
+    }
+
+    block_header header;
+    header.word_offset = static_cast<std::uint32_t>(words_.size());
+    std::uint32_t encoded[block_size];
+
+    if (sorted && bit_width(max_delta) < bit_width(max_offset)) {
+        header.mode = block_mode::delta;
+        header.base = padded[0];
+        header.bits = bit_width(max_delta);
+        encoded[0] = 0;
+        for (std::size_t i = 1; i < block_size; ++i) {
+            encoded[i] = static_cast<std::uint32_t>(padded[i]) - static_cast<std::uint32_t>(padded[i - 1]);
+        }
+    } else {
+        header.mode = block_mode::frame_of_reference;
+        header.base = min_value;
+        header.bits = bit_width(max_offset);
+        for (std::size_t i = 0; i < block_size; ++i) {
+            encoded[i] = static_cast<std::uint32_t>(padded[i]) - static_cast<std::uint32_t>(min_value);
+        }
+    }
+
+    // 128 значений по bits бит = bits слов на каждую из 4 дорожек
+    words_.resize(words_.size() + header.bits * lanes, 0);
+    if (header.bits > 0) {
+        pack_block(encoded, header.bits, words_.data() + header.word_offset);
+    }
+    blocks_.push_back(header);
+}
+
+std::size_t compressed_int_array::decode_block(std::size_t block, int* out) const {
+    const block_header& header = blocks_[block];
+    std::uint32_t* values = reinterpret_cast<std::uint32_t*>(out);
+
+    if (header.bits == 0) {
+        // Все разности нулевые: блок из одинаковых значений
+        std::fill(values, values + block_size, 0u);
+    } else {
+        unpack_block(words_.data() + header.word_offset, header.bits, values);
+    }
+
+    if (header.mode == block_mode::delta) {
+        prefix_sum(values, static_cast<std::uint32_t>(header.base));
+    } else {
+        add_base(values, static_cast<std::uint32_t>(header.base));
+    }
+
+    return std::min(block_size, size_ - block * block_size);
+}
+
+std::size_t compressed_int_array::size() const {
+    return size_;
+}
+
+bool compressed_int_array::empty() const {
+    return size_ == 0;
+}
+
+std::size_t compressed_int_array::block_count() const {
+    return blocks_.size();
+}
+
+int compressed_int_array::operator[](std::size_t index) const {
+    int buffer[block_size];
+    decode_block(index / block_size, buffer);
+    return buffer[index % block_size];
+}
+
+void compressed_int_array::decompress(dynamic_array<int>& out) const {
+    std::size_t start = out.size();
+    out.resize_for_overwrite(start + size_);
+
+    int buffer[block_size];
+    for (std::size_t block = 0; block < blocks_.size(); ++block) {
+        std::size_t count = decode_block(block, buffer);
+        std::copy(buffer, buffer + count, &out[start + block * block_size]);
+    }
+}
+
+std::size_t compressed_int_array::memory_bytes() const {
+    return blocks_.size() * sizeof(block_header) + words_.size() * sizeof(std::uint32_t);
+}
+
+compressed_int_array::const_iterator compressed_int_array::begin() const {
+    return const_iterator(this, 0);
+}
+
+compressed_int_array::const_iterator compressed_int_array::end() const {
+    return const_iterator(this, size_);
+}
+
+compressed_int_array::const_iterator::const_iterator(const compressed_int_array* owner, std::size_t index)
+    : owner_(owner), index_(index), block_(index / block_size) {
+    if (owner_ && index_ < owner_->size_) {
+        owner_->decode_block(block_, buffer_);
+    }
+}
+
+compressed_int_array::const_iterator& compressed_int_array::const_iterator::operator++() {
+    ++index_;
+    if (index_ % block_size == 0 && index_ < owner_->size_) {
+        ++block_;
+        owner_->decode_block(block_, buffer_);
+    }
+    return *this;
+}
+
+compressed_int_array::const_iterator compressed_int_array::const_iterator::operator++(int) {
+    const_iterator temp = *this;
+    ++*this;
+    return temp;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <memory_resource>
+#include <vector>
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include "dynamic_array.h"
+
+// Замороженная сжатая копия dynamic_array<int> для чтения. Значения
+// разбиты на блоки по 128; каждый блок хранится как битовая упаковка
+// либо разностей с минимумом блока (frame of reference), либо разностей
+// соседних элементов (для неубывающих блоков) - что компактнее.
+// Упаковка "вертикальная" по 4 дорожкам, как в SIMD-BP128: одна SSE2
+// инструкция распаковывает сразу 4 значения.
+class compressed_int_array {
+public:
+    static constexpr std::size_t block_size = 128;
+
+private:
+    enum class block_mode : std::uint8_t {
+        frame_of_reference,
+        delta
+    };
+
+    struct block_header {
+        std::uint32_t word_offset;
+        std::int32_t base;
+        std::uint8_t bits;
+        block_mode mode;
+    };
+
+    std::pmr::vector<block_header> blocks_;
+    std::pmr::vector<std::uint32_t> words_;
+    std::size_t size_;
+
+    void encode_block(const int* values, std::size_t count);
+
+public:
+    class const_iterator {
+    private:
+        const compressed_int_array* owner_;
+        std::size_t index_;
+        std::size_t block_;
+        int buffer_[block_size];
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = int;
+
+        const_iterator(const compressed_int_array* owner = nullptr, std::size_t index = 0);
+
+        // Блок декодируется целиком при входе в него
+        int operator*() const { return buffer_[index_ % block_size]; }
+
+        const_iterator& operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+    };
+
+    explicit compressed_int_array(const dynamic_array<int>& source,
+                                  std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+
+    std::size_t size() const;
+    bool empty() const;
+    std::size_t block_count() const;
+
+    // Декодирует блок в out (всегда block_size значений, значимы первые
+    // возвращенные), out должен вмещать block_size значений
+    std::size_t decode_block(std::size_t block, int* out) const;
+
+    // Одиночный доступ: декодирует весь блок, для сканов берите итератор
+    int operator[](std::size_t index) const;
+
+    // Дописывает все значения в конец out
+    void decompress(dynamic_array<int>& out) const;
+
+    // Размер сжатого представления в байтах
+    std::size_t memory_bytes() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+};
@@ -0,0 +1,284 @@
+#include "concurrent_dynamic_array.h"
+#include "person.h"
+#include "test_struct.h"
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <new>
+
+// Явные инстанциации для нужных типов
+template class concurrent_dynamic_array<int>;
+template class concurrent_dynamic_array<std::string>;
+template class concurrent_dynamic_array<Person>;
+template class concurrent_dynamic_array<double>;
+template class concurrent_dynamic_array<TestStruct>;
+
+template<typename T>
+concurrent_dynamic_array<T>::concurrent_dynamic_array(std::pmr::memory_resource* mr)
+    : reserved_(0), published_(0), allocator_(mr) {
+    for (std::size_t k = 0; k < max_segments; ++k) {
+        segments_[k].store(nullptr, std::memory_order_relaxed);
+        states_[k].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+concurrent_dynamic_array<T>::~concurrent_dynamic_array() {
+    std::size_t count = reserved_.load(std::memory_order_acquire);
+    for (std::size_t k = 0; k < max_segments; ++k) {
+        T* segment = segments_[k].load(std::memory_order_relaxed);
+        if (!segment) continue;
+
+        state_flag* states = states_[k].load(std::memory_order_relaxed);
+        std::size_t begin = segment_begin(k);
+        std::size_t end = std::min(count, begin + segment_capacity(k));
+        for (std::size_t i = begin; i < end; ++i) {
+            if (states[i - begin].load(std::memory_order_acquire) == slot_ready) {
+                allocator_.destroy(segment + (i - begin));
+            }
+        }
+        allocator_.resource()->deallocate(states, segment_capacity(k) * sizeof(state_flag), alignof(state_flag));
+        allocator_.deallocate(segment, segment_capacity(k));
+    }
+}
+
+template<typename T>
+std::size_t concurrent_dynamic_array<T>::segment_of(std::size_t index) {
+    // Индекс i лежит в сегменте floor(log2(i / first_segment_size + 1))
+    std::size_t q = index / first_segment_size + 1;
+#if defined(__GNUC__) || defined(__clang__)
+    return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(q);
+#else
+    std::size_t segment = 0;
+    while (q >>= 1) {
+        ++segment;
+    }
+    return segment;
+#endif
+}
+
+template<typename T>
+std::size_t concurrent_dynamic_array<T>::segment_begin(std::size_t segment) {
+    return first_segment_size * ((std::size_t(1) << segment) - 1);
+}
+
+template<typename T>
+std::size_t concurrent_dynamic_array<T>::segment_capacity(std::size_t segment) {
+    return first_segment_size << segment;
+}
+
+template<typename T>
+T* concurrent_dynamic_array<T>::ensure_segment(std::size_t segment) {
+    T* data = segments_[segment].load(std::memory_order_acquire);
+    if (data) {
+        return data;
+    }
+
+    std::lock_guard<std::mutex> lock(segment_mutex_);
+    // Другой поток мог выделить сегмент, пока мы ждали мьютекс
+    data = segments_[segment].load(std::memory_order_relaxed);
+    if (!data) {
+        std::size_t capacity = segment_capacity(segment);
+        data = allocator_.allocate(capacity);
+
+        void* raw = nullptr;
+        try {
+            raw = allocator_.resource()->allocate(capacity * sizeof(state_flag), alignof(state_flag));
+        } catch (...) {
+            allocator_.deallocate(data, capacity);
+            throw;
+        }
+        state_flag* states = static_cast<state_flag*>(raw);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            new (states + i) state_flag(slot_empty);
+        }
+
+        // Слоты, владельцы которых не дождались этого сегмента
+        std::size_t begin = segment_begin(segment);
+        for (std::size_t index : lost_slots_) {
+            if (index >= begin && index < begin + capacity) {
+                states[index - begin].store(slot_failed, std::memory_order_relaxed);
+            }
+        }
+
+        states_[segment].store(states, std::memory_order_release);
+        segments_[segment].store(data, std::memory_order_release);
+    }
+    return data;
+}
+
+template<typename T>
+T* concurrent_dynamic_array<T>::slot(std::size_t index) const {
+    std::size_t segment = segment_of(index);
+    T* data = segments_[segment].load(std::memory_order_acquire);
+    return data + (index - segment_begin(segment));
+}
+
+template<typename T>
+typename concurrent_dynamic_array<T>::state_flag* concurrent_dynamic_array<T>::state(std::size_t index) const {
+    std::size_t segment = segment_of(index);
+    state_flag* states = states_[segment].load(std::memory_order_acquire);
+    return states ? states + (index - segment_begin(segment)) : nullptr;
+}
+
+template<typename T>
+bool concurrent_dynamic_array<T>::settled(std::size_t index) {
+    if (state_flag* flag = state(index)) {
+        return flag->load(std::memory_order_acquire) != slot_empty;
+    }
+
+    // Сегмента нет: слот устоялся, только если его владелец сдался
+    std::lock_guard<std::mutex> lock(segment_mutex_);
+    if (state_flag* flag = state(index)) {
+        return flag->load(std::memory_order_acquire) != slot_empty;
+    }
+    return std::find(lost_slots_.begin(), lost_slots_.end(), index) != lost_slots_.end();
+}
+
+template<typename T>
+bool concurrent_dynamic_array<T>::is_failed(std::size_t index) const {
+    state_flag* flag = state(index);
+    return !flag || flag->load(std::memory_order_acquire) == slot_failed;
+}
+
+template<typename T>
+void concurrent_dynamic_array<T>::settle(std::size_t index, slot_state result) {
+    state(index)->store(result, std::memory_order_release);
+
+    // Частый случай: знак стоит на нашем слоте, продвигаем без проверки
+    std::size_t mark = index;
+    if (published_.compare_exchange_strong(mark, index + 1, std::memory_order_acq_rel)) {
+        if (reserved_.load(std::memory_order_acquire) == index + 1) return;
+    }
+    advance_published();
+}
+
+template<typename T>
+void concurrent_dynamic_array<T>::advance_published() {
+    // Каждый поток продвигает знак после своего слота, поэтому знак не
+    // застревает: владелец первого неустоявшегося слота продвинет его сам
+    std::size_t mark = published_.load(std::memory_order_acquire);
+    while (mark < reserved_.load(std::memory_order_acquire) && settled(mark)) {
+        if (published_.compare_exchange_weak(mark, mark + 1, std::memory_order_acq_rel)) {
+            ++mark;
+        }
+    }
+}
+
+template<typename T>
+template<typename U>
+std::size_t concurrent_dynamic_array<T>::emplace_slot(U&& value) {
+    std::size_t index = reserved_.fetch_add(1, std::memory_order_acq_rel);
+    std::size_t segment = segment_of(index);
+
+    T* data = nullptr;
+    try {
+        data = ensure_segment(segment);
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(segment_mutex_);
+            if (state_flag* flag = state(index)) {
+                // Сегмент успел выделить другой поток
+                flag->store(slot_failed, std::memory_order_release);
+            } else {
+                lost_slots_.push_back(index);
+            }
+        }
+        advance_published();
+        throw;
+    }
+
+    try {
+        allocator_.construct(data + (index - segment_begin(segment)), std::forward<U>(value));
+    } catch (...) {
+        settle(index, slot_failed);
+        throw;
+    }
+    settle(index, slot_ready);
+    return index;
+}
+
+template<typename T>
+std::size_t concurrent_dynamic_array<T>::push_back(const T& value) {
+    return emplace_slot(value);
+}
+
+template<typename T>
+std::size_t concurrent_dynamic_array<T>::push_back(T&& value) {
+    return emplace_slot(std::move(value));
+}
+
+template<typename T>
+void concurrent_dynamic_array<T>::reserve(std::size_t n) {
+    if (n == 0) return;
+    std::size_t last = segment_of(n - 1);
+    for (std::size_t k = 0; k <= last; ++k) {
+        ensure_segment(k);
+    }
+}
+
+template<typename T>
+T& concurrent_dynamic_array<T>::operator[](std::size_t index) {
+    return *slot(index);
+}
+
+template<typename T>
+const T& concurrent_dynamic_array<T>::operator[](std::size_t index) const {
+    return *slot(index);
+}
+
+template<typename T>
+std::size_t concurrent_dynamic_array<T>::size() const {
+    return published_.load(std::memory_order_acquire);
+}
+
+template<typename T>
+bool concurrent_dynamic_array<T>::published(std::size_t index) const {
+    state_flag* flag = state(index);
+    return flag && flag->load(std::memory_order_acquire) == slot_ready;
+}
+
+template<typename T>
+std::size_t concurrent_dynamic_array<T>::capacity() const {
+    std::size_t total = 0;
+    for (std::size_t k = 0; k < max_segments; ++k) {
+        if (!segments_[k].load(std::memory_order_acquire)) break;
+        total += segment_capacity(k);
+    }
+    return total;
+}
+
+template<typename T>
+bool concurrent_dynamic_array<T>::empty() const {
+    return size() == 0;
+}
+
+template<typename T>
+typename concurrent_dynamic_array<T>::iterator concurrent_dynamic_array<T>::begin() {
+    return iterator(this, 0);
+}
+
+template<typename T>
+typename concurrent_dynamic_array<T>::iterator concurrent_dynamic_array<T>::end() {
+    return iterator(this, size());
+}
+
+template<typename T>
+typename concurrent_dynamic_array<T>::const_iterator concurrent_dynamic_array<T>::begin() const {
+    return const_iterator(this, 0);
+}
+
+template<typename T>
+typename concurrent_dynamic_array<T>::const_iterator concurrent_dynamic_array<T>::end() const {
+    return const_iterator(this, size());
+}
+
+template<typename T>
+typename concurrent_dynamic_array<T>::const_iterator concurrent_dynamic_array<T>::cbegin() const {
+    return const_iterator(this, 0);
+}
+
+template<typename T>
+typename concurrent_dynamic_array<T>::const_iterator concurrent_dynamic_array<T>::cend() const {
+    return const_iterator(this, size());
+}
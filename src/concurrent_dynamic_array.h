@@ -0,0 +1,155 @@
+#pragma once
+#include <memory_resource>
+#include <atomic>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+// Массив для конкурентного добавления из нескольких потоков.
+// Слот резервируется атомарным fetch_add по размеру, а память растет
+// сегментами: сегмент k хранит first_segment_size * 2^k элементов.
+// Уже выделенные сегменты никогда не переезжают, поэтому ссылки на
+// опубликованные элементы остаются валидными во время роста.
+//
+// У каждого слота есть флаг состояния (пуст / построен / сбой), а size()
+// возвращает водяной знак: все слоты ниже него уже устоялись. Слот со
+// сбоем остается, если push_back бросил исключение (нет памяти под
+// сегмент или исключение конструктора); такие слоты не разрушаются
+// и пропускаются итераторами.
+template<typename T>
+class concurrent_dynamic_array {
+private:
+    static constexpr std::size_t first_segment_size = 8;
+    static constexpr std::size_t max_segments = 48;
+
+    enum slot_state : std::uint8_t {
+        slot_empty,
+        slot_ready,
+        slot_failed
+    };
+    using state_flag = std::atomic<std::uint8_t>;
+
+    std::atomic<T*> segments_[max_segments];
+    std::atomic<state_flag*> states_[max_segments];
+    std::atomic<std::size_t> reserved_;
+    std::atomic<std::size_t> published_;
+    std::pmr::polymorphic_allocator<T> allocator_;
+
+    // Ресурс памяти не обязан быть потокобезопасным, поэтому
+    // выделение новых сегментов сериализуется (это редкая операция).
+    std::mutex segment_mutex_;
+    // Слоты, для которых не удалось выделить сегмент (под segment_mutex_)
+    std::vector<std::size_t> lost_slots_;
+
+    static std::size_t segment_of(std::size_t index);
+    static std::size_t segment_begin(std::size_t segment);
+    static std::size_t segment_capacity(std::size_t segment);
+
+    T* ensure_segment(std::size_t segment);
+    T* slot(std::size_t index) const;
+    state_flag* state(std::size_t index) const;
+    bool settled(std::size_t index);
+    bool is_failed(std::size_t index) const;
+    void settle(std::size_t index, slot_state result);
+    void advance_published();
+
+    template<typename U>
+    std::size_t emplace_slot(U&& value);
+
+public:
+    template<typename U>
+    class basic_iterator {
+    private:
+        const concurrent_dynamic_array* owner_;
+        std::size_t index_;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = U;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        basic_iterator(const concurrent_dynamic_array* owner = nullptr, std::size_t index = 0)
+            : owner_(owner), index_(index) {
+            skip_failed();
+        }
+
+        // Пропускает слоты со сбоем ниже водяного знака
+        void skip_failed() {
+            while (owner_ && index_ < owner_->size() && owner_->is_failed(index_)) {
+                ++index_;
+            }
+        }
+
+        reference operator*() const { return *owner_->slot(index_); }
+        pointer operator->() const { return owner_->slot(index_); }
+
+        basic_iterator& operator++() {
+            ++index_;
+            skip_failed();
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const basic_iterator& other) const {
+            return owner_ == other.owner_ && index_ == other.index_;
+        }
+
+        bool operator!=(const basic_iterator& other) const {
+            return !(*this == other);
+        }
+
+        operator basic_iterator<const U>() const {
+            return basic_iterator<const U>(owner_, index_);
+        }
+    };
+
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    explicit concurrent_dynamic_array(std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+    ~concurrent_dynamic_array();
+
+    // Запрещаем копирование и перемещение для простоты
+    concurrent_dynamic_array(const concurrent_dynamic_array&) = delete;
+    concurrent_dynamic_array& operator=(const concurrent_dynamic_array&) = delete;
+
+    // Потокобезопасное добавление; возвращает индекс записанного элемента.
+    // Элемент виден другим потокам после синхронизации с потоком-писателем
+    // (join, мьютекс, атомарный флаг и т.п.).
+    std::size_t push_back(const T& value);
+    std::size_t push_back(T&& value);
+
+    // Заранее выделяет сегменты под n элементов
+    void reserve(std::size_t n);
+
+    // Доступ к построенным элементам: индексам, которые вернул push_back
+    // этого потока, или индексам ниже size() с published(index) == true.
+    // Для таких элементов доступ безопасен конкурентно с push_back.
+    T& operator[](std::size_t index);
+    const T& operator[](std::size_t index) const;
+
+    // Водяной знак: все слоты в [0, size()) устоялись - построены или
+    // остались пустыми после сбоя push_back. Растет монотонно.
+    std::size_t size() const;
+    // Элемент построен и виден вызывающему потоку
+    bool published(std::size_t index) const;
+    std::size_t capacity() const;
+    bool empty() const;
+
+    // Итераторы по [0, size()) без слотов со сбоем
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+};
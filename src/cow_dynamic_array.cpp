@@ -0,0 +1,103 @@
+#include "cow_dynamic_array.h"
+#include "person.h"
+#include "test_struct.h"
+#include <string>
+#include <atomic>
+
+// Явные инстанциации для нужных типов
+template class cow_dynamic_array<int>;
+template class cow_dynamic_array<std::string>;
+template class cow_dynamic_array<Person>;
+template class cow_dynamic_array<double>;
+template class cow_dynamic_array<TestStruct>;
+
+// use_count() == 1 значит, что снимков с этим объектом не осталось, а
+// новые ссылки создает только поток-писатель. Барьер acquire упорядочивает
+// наши записи после чтений потока, который освободил последний снимок.
+template<typename U>
+static bool exclusive(const std::shared_ptr<U>& p) {
+    if (p.use_count() != 1) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+}
+
+template<typename T>
+cow_dynamic_array<T>::cow_dynamic_array(std::pmr::memory_resource* mr)
+    : table_(std::make_shared<chunk_table>()), size_(0), mr_(mr) {}
+
+template<typename T>
+typename cow_dynamic_array<T>::chunk_table& cow_dynamic_array<T>::own_table() {
+    if (!exclusive(table_)) {
+        // Копируются только указатели, чанки остаются общими
+        table_ = std::make_shared<chunk_table>(*table_);
+    }
+    return *table_;
+}
+
+template<typename T>
+typename cow_dynamic_array<T>::chunk& cow_dynamic_array<T>::own_chunk(std::size_t chunk_index) {
+    std::shared_ptr<chunk>& slot = own_table()[chunk_index];
+    if (!exclusive(slot)) {
+        auto copy = std::make_shared<chunk>(mr_);
+        copy->reserve(chunk_size);
+        for (const auto& item : *slot) {
+            copy->push_back(item);
+        }
+        slot = std::move(copy);
+    }
+    return *slot;
+}
+
+template<typename T>
+void cow_dynamic_array<T>::push_back(const T& value) {
+    T copy = value;
+    push_back(std::move(copy));
+}
+
+template<typename T>
+void cow_dynamic_array<T>::push_back(T&& value) {
+    if (size_ % chunk_size == 0) {
+        // Емкость чанка фиксирована, чтобы он никогда не переезжал
+        auto fresh = std::make_shared<chunk>(mr_);
+        fresh->reserve(chunk_size);
+        own_table().push_back(std::move(fresh));
+    }
+    own_chunk(size_ / chunk_size).push_back(std::move(value));
+    ++size_;
+}
+
+template<typename T>
+void cow_dynamic_array<T>::pop_back() {
+    if (size_ == 0) return;
+
+    --size_;
+    own_chunk(size_ / chunk_size).pop_back();
+    if (size_ % chunk_size == 0) {
+        own_table().pop_back();
+    }
+}
+
+template<typename T>
+const T& cow_dynamic_array<T>::operator[](std::size_t index) const {
+    return (*(*table_)[index / chunk_size])[index % chunk_size];
+}
+
+template<typename T>
+T& cow_dynamic_array<T>::modify(std::size_t index) {
+    return own_chunk(index / chunk_size)[index % chunk_size];
+}
+
+template<typename T>
+std::size_t cow_dynamic_array<T>::size() const {
+    return size_;
+}
+
+template<typename T>
+bool cow_dynamic_array<T>::empty() const {
+    return size_ == 0;
+}
+
+template<typename T>
+typename cow_dynamic_array<T>::snapshot cow_dynamic_array<T>::take_snapshot() const {
+    return snapshot(table_, size_);
+}
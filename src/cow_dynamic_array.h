@@ -0,0 +1,121 @@
+#pragma once
+#include <memory_resource>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include "dynamic_array.h"
+
+// Массив с дешевыми снимками для читателей из других потоков.
+// Элементы лежат в чанках по chunk_size, чанки и таблица чанков
+// разделяются через shared_ptr. take_snapshot() за O(1) копирует указатель
+// на таблицу; первая запись после снимка копирует таблицу (O(n / chunk_size)
+// указателей) и только тот чанк, в который пишет. Нетронутые чанки
+// остаются общими для массива и всех снимков.
+//
+// Все изменения и take_snapshot() вызываются из одного потока-писателя.
+// Снимки неизменяемы: их можно передавать в другие потоки, читать и
+// разрушать там без блокировок. Ресурс памяти должен быть
+// потокобезопасным, если последний снимок может освободиться вне
+// потока-писателя (ресурс по умолчанию подходит).
+template<typename T>
+class cow_dynamic_array {
+public:
+    static constexpr std::size_t chunk_size = 64;
+
+private:
+    using chunk = dynamic_array<T>;
+    using chunk_table = std::vector<std::shared_ptr<chunk>>;
+
+    std::shared_ptr<chunk_table> table_;
+    std::size_t size_;
+    std::pmr::memory_resource* mr_;
+
+    chunk_table& own_table();
+    chunk& own_chunk(std::size_t chunk_index);
+
+public:
+    class snapshot {
+    private:
+        std::shared_ptr<const chunk_table> table_;
+        std::size_t size_;
+
+        friend class cow_dynamic_array;
+        snapshot(std::shared_ptr<const chunk_table> table, std::size_t size)
+            : table_(std::move(table)), size_(size) {}
+
+    public:
+        class const_iterator {
+        private:
+            const snapshot* owner_;
+            std::size_t index_;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator(const snapshot* owner = nullptr, std::size_t index = 0)
+                : owner_(owner), index_(index) {}
+
+            reference operator*() const { return (*owner_)[index_]; }
+            pointer operator->() const { return &(*owner_)[index_]; }
+
+            const_iterator& operator++() {
+                ++index_;
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++index_;
+                return temp;
+            }
+
+            bool operator==(const const_iterator& other) const {
+                return owner_ == other.owner_ && index_ == other.index_;
+            }
+
+            bool operator!=(const const_iterator& other) const {
+                return !(*this == other);
+            }
+        };
+
+        snapshot() : size_(0) {}
+
+        const T& operator[](std::size_t index) const {
+            return (*(*table_)[index / chunk_size])[index % chunk_size];
+        }
+
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size_); }
+    };
+
+    explicit cow_dynamic_array(std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+
+    // Запрещаем копирование для простоты (для копий есть snapshot)
+    cow_dynamic_array(const cow_dynamic_array&) = delete;
+    cow_dynamic_array& operator=(const cow_dynamic_array&) = delete;
+
+    void push_back(const T& value);
+    void push_back(T&& value);
+    void pop_back();
+
+    // Чтение без копирования
+    const T& operator[](std::size_t index) const;
+
+    // Доступ на запись: если чанк разделен со снимком, он копируется
+    T& modify(std::size_t index);
+
+    std::size_t size() const;
+    bool empty() const;
+
+    // Неизменяемая версия текущего содержимого за O(1)
+    snapshot take_snapshot() const;
+};
@@ -4,6 +4,10 @@
 #include <iostream>
 #include <utility>
 #include <string>
+#include <cstring>
+#include <type_traits>
+#include <memory>
+#include <new>
 
 // Явные инстанциации для нужных типов
 template class dynamic_array<int>;
@@ -27,11 +31,45 @@ dynamic_array<T>::dynamic_array(std::size_t initial_size, std::pmr::memory_resou
     size_ = initial_size;
     
     // Инициализируем элементы
-    for (std::size_t i = 0; i < size_; ++i) {
-        allocator_.construct(&data_[i], T{});
+    if constexpr (std::is_trivially_default_constructible_v<T>) {
+        // Обнуление одним проходом вместо поэлементного T{}
+        std::uninitialized_value_construct_n(data_, size_);
+    } else {
+        for (std::size_t i = 0; i < size_; ++i) {
+            allocator_.construct(&data_[i], T{});
+        }
+    }
+}
+
+template<typename T>
+dynamic_array<T>::dynamic_array(std::size_t initial_size, default_init_t, std::pmr::memory_resource* mr)
+    : data_(nullptr), size_(0), capacity_(0), allocator_(mr) {
+    resize_for_overwrite(initial_size);
+}
+
+template<typename T>
+dynamic_array<T>::dynamic_array(std::size_t initial_size, const T& value, std::pmr::memory_resource* mr)
+    : data_(nullptr), size_(0), capacity_(0), allocator_(mr) {
+    resize(initial_size);
+    size_ = initial_size;
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::uninitialized_fill_n(data_, size_, value);
+    } else {
+        for (std::size_t i = 0; i < size_; ++i) {
+            allocator_.construct(&data_[i], value);
+        }
     }
 }
 
+template<typename T>
+dynamic_array<T>::dynamic_array(dynamic_array&& other) noexcept
+    : data_(other.data_), size_(other.size_), capacity_(other.capacity_), allocator_(other.allocator_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.capacity_ = 0;
+}
+
 template<typename T>
 dynamic_array<T>::~dynamic_array() {
     if (data_) {
@@ -62,6 +100,14 @@ void dynamic_array<T>::resize(std::size_t new_capacity) {
     capacity_ = new_capacity;
 }
 
+template<typename T>
+void dynamic_array<T>::destroy_tail(std::size_t new_size) {
+    for (std::size_t i = new_size; i < size_; ++i) {
+        allocator_.destroy(&data_[i]);
+    }
+    size_ = new_size;
+}
+
 template<typename T>
 T& dynamic_array<T>::operator[](std::size_t index) {
     return data_[index];
@@ -87,6 +133,35 @@ bool dynamic_array<T>::empty() const {
     return size_ == 0;
 }
 
+template<typename T>
+void dynamic_array<T>::reserve(std::size_t new_capacity) {
+    resize(new_capacity);
+}
+
+template<typename T>
+std::pmr::memory_resource* dynamic_array<T>::resource() const {
+    return allocator_.resource();
+}
+
+template<typename T>
+void dynamic_array<T>::resize_for_overwrite(std::size_t new_size) {
+    if (new_size <= size_) {
+        destroy_tail(new_size);
+        return;
+    }
+
+    resize(new_size);
+    if constexpr (std::is_trivially_default_constructible_v<T>) {
+        // Default-инициализация тривиального типа не пишет в память
+        std::uninitialized_default_construct_n(data_ + size_, new_size - size_);
+    } else {
+        for (std::size_t i = size_; i < new_size; ++i) {
+            allocator_.construct(&data_[i]);
+        }
+    }
+    size_ = new_size;
+}
+
 template<typename T>
 void dynamic_array<T>::push_back(const T& value) {
     if (size_ >= capacity_) {
@@ -105,6 +180,69 @@ void dynamic_array<T>::push_back(T&& value) {
     ++size_;
 }
 
+template<typename T>
+typename dynamic_array<T>::iterator dynamic_array<T>::insert(const_iterator pos, const T& value) {
+    // value может ссылаться на элемент самого массива
+    return insert(pos, T(value));
+}
+
+template<typename T>
+typename dynamic_array<T>::iterator dynamic_array<T>::insert(const_iterator pos, T&& value) {
+    std::size_t index = static_cast<std::size_t>(pos.base() - data_);
+
+    if (size_ >= capacity_) {
+        resize(capacity_ == 0 ? 1 : capacity_ * 2);
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        // Сдвиг хвоста одним memmove
+        std::memmove(data_ + index + 1, data_ + index, (size_ - index) * sizeof(T));
+        allocator_.construct(&data_[index], std::move(value));
+    } else if (index == size_) {
+        allocator_.construct(&data_[size_], std::move(value));
+    } else {
+        allocator_.construct(&data_[size_], std::move(data_[size_ - 1]));
+        std::move_backward(data_ + index, data_ + size_ - 1, data_ + size_);
+        data_[index] = std::move(value);
+    }
+    ++size_;
+    return iterator(data_ + index);
+}
+
+template<typename T>
+void dynamic_array<T>::pop_back() {
+    if (size_ == 0) return;
+    destroy_tail(size_ - 1);
+}
+
+template<typename T>
+typename dynamic_array<T>::iterator dynamic_array<T>::erase(const_iterator pos) {
+    const_iterator next = pos;
+    return erase(pos, ++next);
+}
+
+template<typename T>
+typename dynamic_array<T>::iterator dynamic_array<T>::erase(const_iterator first, const_iterator last) {
+    std::size_t from = static_cast<std::size_t>(first.base() - data_);
+    std::size_t to = static_cast<std::size_t>(last.base() - data_);
+    std::size_t count = to - from;
+    if (count == 0) return iterator(data_ + from);
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memmove(data_ + from, data_ + to, (size_ - to) * sizeof(T));
+        size_ -= count;
+    } else {
+        std::move(data_ + to, data_ + size_, data_ + from);
+        destroy_tail(size_ - count);
+    }
+    return iterator(data_ + from);
+}
+
+template<typename T>
+void dynamic_array<T>::clear() {
+    destroy_tail(0);
+}
+
 template<typename T>
 typename dynamic_array<T>::iterator dynamic_array<T>::begin() {
     return iterator(data_);
@@ -1,6 +1,16 @@
 #pragma once
 #include <memory_resource>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
 #include "iterator.h"
+#include "radix_sort.h"
+
+// Тег для конструктора без value-инициализации элементов
+struct default_init_t {
+    explicit default_init_t() = default;
+};
+inline constexpr default_init_t default_init{};
 
 template<typename T>
 class dynamic_array {
@@ -11,6 +21,10 @@ private:
     std::pmr::polymorphic_allocator<T> allocator_;
 
     void resize(std::size_t new_capacity);
+    void destroy_tail(std::size_t new_size);
+
+    template<typename Item, typename KeyOf>
+    void apply_sorted_order(Item* order, KeyOf index_of);
 
 public:
     using iterator = dynamic_array_iterator<T>;
@@ -18,11 +32,24 @@ public:
 
     explicit dynamic_array(std::pmr::memory_resource* mr = std::pmr::get_default_resource());
     dynamic_array(std::size_t initial_size, std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+    // Элементы default-инициализируются: для double/int память не трогается
+    dynamic_array(std::size_t initial_size, default_init_t, std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+    // Заполнение копиями value (для тривиальных T - векторизуемый fill)
+    dynamic_array(std::size_t initial_size, const T& value, std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+    // Значение другого типа, например dynamic_array<double>(n, 0): без
+    // этой перегрузки литерал 0 одинаково подходит и как value, и как
+    // нулевой memory_resource*
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<const U&, T> &&
+                                                     !std::is_convertible_v<const U&, std::pmr::memory_resource*>>>
+    dynamic_array(std::size_t initial_size, const U& value, std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+        : dynamic_array(initial_size, static_cast<const T&>(T(value)), mr) {}
     ~dynamic_array();
 
-    // Запрещаем копирование и перемещение для простоты
+    // Запрещаем копирование для простоты; перемещение нужно, чтобы
+    // возвращать массивы из функций (views::collect)
     dynamic_array(const dynamic_array&) = delete;
     dynamic_array& operator=(const dynamic_array&) = delete;
+    dynamic_array(dynamic_array&& other) noexcept;
 
     // Доступ к элементам
     T& operator[](std::size_t index);
@@ -32,11 +59,32 @@ public:
     std::size_t size() const;
     std::size_t capacity() const;
     bool empty() const;
+    void reserve(std::size_t new_capacity);
+    std::pmr::memory_resource* resource() const;
+
+    // Меняет размер; новые элементы default-инициализируются, поэтому
+    // для тривиальных T их нужно перезаписать перед чтением
+    void resize_for_overwrite(std::size_t new_size);
 
     // Добавление элементов
     void push_back(const T& value);
     void push_back(T&& value);
 
+    // Вставка перед pos со сдвигом хвоста; возвращает итератор на новый элемент
+    iterator insert(const_iterator pos, const T& value);
+    iterator insert(const_iterator pos, T&& value);
+
+    // Удаление элементов (pop_back на пустом массиве ничего не делает)
+    void pop_back();
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    void clear();
+
+    // Удаляет элементы, для которых pred истинен, за один проход без
+    // перевыделения памяти; возвращает число удаленных
+    template<typename Predicate>
+    std::size_t erase_if(Predicate pred);
+
     // Итераторы
     iterator begin();
     iterator end();
@@ -44,4 +92,174 @@ public:
     const_iterator end() const;
     const_iterator cbegin() const;
     const_iterator cend() const;
-};
\ No newline at end of file
+
+    // Сортировка. Для арифметических T и порядка по умолчанию используется
+    // LSD radix sort, иначе std::sort. Буферы берутся из ресурса массива.
+    template<typename Compare = std::less<>>
+    void sort(Compare comp = Compare{});
+
+    // Устойчивая сортировка по ключу, например по Person::age.
+    // Арифметические ключи сортируются поразрядно.
+    template<typename KeyFn>
+    void sort_by_key(KeyFn key);
+
+    // Удаляет подряд идущие равные элементы; возвращает число удаленных
+    template<typename BinaryPredicate = std::equal_to<>>
+    std::size_t unique(BinaryPredicate pred = BinaryPredicate{});
+
+    // Двоичный поиск по отсортированному массиву
+    template<typename U, typename Compare = std::less<>>
+    iterator lower_bound(const U& value, Compare comp = Compare{});
+    template<typename U, typename Compare = std::less<>>
+    const_iterator lower_bound(const U& value, Compare comp = Compare{}) const;
+    template<typename U, typename Compare = std::less<>>
+    bool binary_search(const U& value, Compare comp = Compare{}) const;
+
+    // Двоичный поиск по массиву, отсортированному sort_by_key
+    template<typename K, typename KeyFn>
+    const_iterator lower_bound_by_key(const K& key_value, KeyFn key) const;
+    template<typename K, typename KeyFn>
+    bool binary_search_by_key(const K& key_value, KeyFn key) const;
+};
+
+template<typename T>
+template<typename Item, typename KeyOf>
+void dynamic_array<T>::apply_sorted_order(Item* order, KeyOf index_of) {
+    // Переставляем элементы по циклам перестановки: order[i] указывает,
+    // какой элемент должен оказаться на позиции i
+    for (std::size_t i = 0; i < size_; ++i) {
+        if (index_of(order[i]) == i) continue;
+
+        T temp = std::move(data_[i]);
+        std::size_t j = i;
+        while (index_of(order[j]) != i) {
+            std::size_t next = index_of(order[j]);
+            data_[j] = std::move(data_[next]);
+            index_of(order[j]) = j;
+            j = next;
+        }
+        data_[j] = std::move(temp);
+        index_of(order[j]) = j;
+    }
+}
+
+template<typename T>
+template<typename Predicate>
+std::size_t dynamic_array<T>::erase_if(Predicate pred) {
+    // Уплотнение: оставшиеся элементы сдвигаются к началу по порядку
+    std::size_t write = 0;
+    for (std::size_t read = 0; read < size_; ++read) {
+        if (pred(data_[read])) continue;
+        if (write != read) {
+            data_[write] = std::move(data_[read]);
+        }
+        ++write;
+    }
+
+    std::size_t removed = size_ - write;
+    destroy_tail(write);
+    return removed;
+}
+
+template<typename T>
+template<typename Compare>
+void dynamic_array<T>::sort(Compare comp) {
+    if (size_ < 2) return;
+
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                  std::is_same_v<Compare, std::less<>>) {
+        using U = radix_key_t<T>;
+        scratch_buffer<U> keys(size_, allocator_.resource());
+        scratch_buffer<U> scratch(size_, allocator_.resource());
+
+        for (std::size_t i = 0; i < size_; ++i) {
+            keys.data()[i] = radix_key<T>::encode(data_[i]);
+        }
+        radix_sort(keys.data(), scratch.data(), size_, [](U key) { return key; });
+        for (std::size_t i = 0; i < size_; ++i) {
+            data_[i] = radix_key<T>::decode(keys.data()[i]);
+        }
+    } else {
+        std::sort(data_, data_ + size_, comp);
+    }
+}
+
+template<typename T>
+template<typename KeyFn>
+void dynamic_array<T>::sort_by_key(KeyFn key) {
+    if (size_ < 2) return;
+
+    using K = std::decay_t<std::invoke_result_t<KeyFn&, const T&>>;
+
+    if constexpr (std::is_arithmetic_v<K> && !std::is_same_v<K, bool>) {
+        using U = radix_key_t<K>;
+        scratch_buffer<radix_pair<U>> order(size_, allocator_.resource());
+        scratch_buffer<radix_pair<U>> scratch(size_, allocator_.resource());
+
+        for (std::size_t i = 0; i < size_; ++i) {
+            order.data()[i] = {radix_key<K>::encode(std::invoke(key, data_[i])), i};
+        }
+        radix_sort(order.data(), scratch.data(), size_,
+                   [](const radix_pair<U>& item) { return item.key; });
+        apply_sorted_order(order.data(),
+                           [](radix_pair<U>& item) -> std::size_t& { return item.index; });
+    } else {
+        // Сортируются индексы, чтобы буферы были из ресурса массива
+        scratch_buffer<std::size_t> order(size_, allocator_.resource());
+        scratch_buffer<std::size_t> scratch(size_, allocator_.resource());
+
+        for (std::size_t i = 0; i < size_; ++i) {
+            order.data()[i] = i;
+        }
+        merge_sort(order.data(), scratch.data(), size_, [this, &key](std::size_t a, std::size_t b) {
+            return std::invoke(key, data_[a]) < std::invoke(key, data_[b]);
+        });
+        apply_sorted_order(order.data(), [](std::size_t& index) -> std::size_t& { return index; });
+    }
+}
+
+template<typename T>
+template<typename BinaryPredicate>
+std::size_t dynamic_array<T>::unique(BinaryPredicate pred) {
+    std::size_t old_size = size_;
+    T* new_end = std::unique(data_, data_ + size_, pred);
+    destroy_tail(static_cast<std::size_t>(new_end - data_));
+    return old_size - size_;
+}
+
+template<typename T>
+template<typename U, typename Compare>
+typename dynamic_array<T>::iterator dynamic_array<T>::lower_bound(const U& value, Compare comp) {
+    return iterator(std::lower_bound(data_, data_ + size_, value, comp));
+}
+
+template<typename T>
+template<typename U, typename Compare>
+typename dynamic_array<T>::const_iterator dynamic_array<T>::lower_bound(const U& value, Compare comp) const {
+    return const_iterator(std::lower_bound(data_, data_ + size_, value, comp));
+}
+
+template<typename T>
+template<typename U, typename Compare>
+bool dynamic_array<T>::binary_search(const U& value, Compare comp) const {
+    return std::binary_search(data_, data_ + size_, value, comp);
+}
+
+template<typename T>
+template<typename K, typename KeyFn>
+typename dynamic_array<T>::const_iterator dynamic_array<T>::lower_bound_by_key(const K& key_value, KeyFn key) const {
+    return const_iterator(std::lower_bound(data_, data_ + size_, key_value,
+        [&key](const T& element, const K& value) {
+            return std::invoke(key, element) < value;
+        }));
+}
+
+template<typename T>
+template<typename K, typename KeyFn>
+bool dynamic_array<T>::binary_search_by_key(const K& key_value, KeyFn key) const {
+    const T* it = std::lower_bound(data_, data_ + size_, key_value,
+        [&key](const T& element, const K& value) {
+            return std::invoke(key, element) < value;
+        });
+    return it != data_ + size_ && !(key_value < std::invoke(key, *it));
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "guarded_memory_resource.h"
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+static std::size_t round_up(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+static const char* violation_name(guarded_memory_resource::guard_violation violation) {
+    switch (violation) {
+        case guarded_memory_resource::guard_violation::double_free: return "double free";
+        case guarded_memory_resource::guard_violation::foreign_pointer: return "foreign pointer";
+        case guarded_memory_resource::guard_violation::buffer_overflow: return "buffer overflow";
+        case guarded_memory_resource::guard_violation::use_after_free: return "use after free";
+        case guarded_memory_resource::guard_violation::size_mismatch: return "size mismatch";
+    }
+    return "unknown violation";
+}
+
+guarded_memory_resource::guarded_memory_resource(std::pmr::memory_resource* upstream,
+                                                 std::size_t max_quarantine_bytes)
+    : upstream_(upstream), max_quarantine_bytes_(max_quarantine_bytes), quarantined_bytes_(0) {}
+
+guarded_memory_resource::~guarded_memory_resource() {
+    // Деструктор не должен бросать, поэтому блоки возвращаются без проверок
+    for (const auto& entry : quarantined_) {
+        release(entry.first, entry.second);
+    }
+    for (const auto& entry : live_) {
+        release(entry.first, entry.second);
+    }
+    quarantine_.clear();
+    quarantined_.clear();
+    live_.clear();
+}
+
+guarded_memory_resource::header* guarded_memory_resource::header_of(void* p) {
+    return reinterpret_cast<header*>(static_cast<char*>(p) - sizeof(header));
+}
+
+std::size_t guarded_memory_resource::total_size(const layout& l) {
+    return l.prefix + l.bytes + sizeof(std::uint64_t);
+}
+
+bool guarded_memory_resource::tail_intact(void* p, std::size_t bytes) {
+    std::uint64_t tail;
+    std::memcpy(&tail, static_cast<char*>(p) + bytes, sizeof(tail));
+    return tail == canary;
+}
+
+void guarded_memory_resource::report(guard_violation violation, void* p) {
+    if (handler_) {
+        handler_(violation, p);
+        return;
+    }
+    std::cerr << "guarded_memory_resource: " << violation_name(violation)
+              << " at " << p << std::endl;
+    std::abort();
+}
+
+void guarded_memory_resource::release(void* p, const layout& l) {
+    upstream_->deallocate(static_cast<char*>(p) - l.prefix, total_size(l), l.alignment);
+}
+
+void guarded_memory_resource::evict_oldest() {
+    void* p = quarantine_.front();
+    quarantine_.pop_front();
+    auto it = quarantined_.find(p);
+    layout l = it->second;
+    quarantined_.erase(it);
+    quarantined_bytes_ -= total_size(l);
+
+    // Размеры берутся из копии, а не из заголовка, который мог быть
+    // перезаписан вместе с канарейкой
+    const unsigned char* bytes = static_cast<const unsigned char*>(p);
+    bool poisoned = std::all_of(bytes, bytes + l.bytes,
+        [](unsigned char b) { return b == poison; });
+    bool intact = header_of(p)->front_canary == canary && tail_intact(p, l.bytes) && poisoned;
+
+    // Блок возвращается до вызова обработчика, чтобы он не потерялся,
+    // даже если обработчик бросает исключение
+    release(p, l);
+    if (!intact) {
+        // Кто-то писал в блок после освобождения
+        report(guard_violation::use_after_free, p);
+    }
+}
+
+void* guarded_memory_resource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    std::size_t prefix = round_up(sizeof(header), alignment);
+
+    char* raw = static_cast<char*>(
+        upstream_->allocate(prefix + bytes + sizeof(std::uint64_t), alignment));
+    char* user = raw + prefix;
+
+    header* h = header_of(user);
+    h->bytes = bytes;
+    h->alignment = alignment;
+    h->prefix = prefix;
+    h->front_canary = canary;
+    std::memcpy(user + bytes, &canary, sizeof(canary));
+
+    live_.emplace(user, layout{bytes, alignment, prefix});
+    return user;
+}
+
+void guarded_memory_resource::do_deallocate(void* p, std::size_t bytes, std::size_t /*alignment*/) {
+    auto it = live_.find(p);
+    if (it == live_.end()) {
+        bool in_quarantine = quarantined_.find(p) != quarantined_.end();
+        report(in_quarantine ? guard_violation::double_free : guard_violation::foreign_pointer, p);
+        return;
+    }
+
+    // Размеры берутся из копии: заголовок мог быть перезаписан
+    layout l = it->second;
+    if (header_of(p)->front_canary != canary) {
+        // Блок испорчен перед началом: в карантин не кладем, сразу
+        // возвращаем upstream (до обработчика, чтобы не потерять)
+        live_.erase(it);
+        release(p, l);
+        report(guard_violation::buffer_overflow, p);
+        return;
+    }
+    if (!tail_intact(p, l.bytes)) {
+        report(guard_violation::buffer_overflow, p);
+    }
+    if (bytes != l.bytes) {
+        report(guard_violation::size_mismatch, p);
+    }
+
+    live_.erase(p);
+    std::memset(p, poison, l.bytes);
+    std::memcpy(static_cast<char*>(p) + l.bytes, &canary, sizeof(canary));
+
+    quarantine_.push_back(p);
+    quarantined_.emplace(p, l);
+    quarantined_bytes_ += total_size(l);
+    while (quarantined_bytes_ > max_quarantine_bytes_ && !quarantine_.empty()) {
+        evict_oldest();
+    }
+}
+
+bool guarded_memory_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void guarded_memory_resource::set_violation_handler(violation_handler handler) {
+    handler_ = std::move(handler);
+}
+
+void guarded_memory_resource::flush_quarantine() {
+    while (!quarantine_.empty()) {
+        evict_oldest();
+    }
+}
+
+std::size_t guarded_memory_resource::live_blocks() const {
+    return live_.size();
+}
+
+std::size_t guarded_memory_resource::quarantined_bytes() const {
+    return quarantined_bytes_;
+}
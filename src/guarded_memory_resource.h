@@ -0,0 +1,85 @@
+#pragma once
+#include <memory_resource>
+#include <unordered_map>
+#include <deque>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+// Отладочный ресурс для канареечных развертываний. Каждый блок окружен
+// канареечными словами, освобожденная память заливается ядом и проходит
+// через FIFO-карантин, прежде чем вернуться upstream. Двойное
+// освобождение и чужие указатели - жесткая ошибка.
+// Накладные расходы ограничены: заголовок и хвост на блок, один проход
+// заливки при освобождении, одна проверка при выходе из карантина и
+// карантин не больше max_quarantine_bytes.
+class guarded_memory_resource : public std::pmr::memory_resource {
+public:
+    enum class guard_violation {
+        double_free,
+        foreign_pointer,
+        buffer_overflow,
+        use_after_free,
+        size_mismatch
+    };
+
+    // По умолчанию печатает диагностику в std::cerr и вызывает std::abort()
+    using violation_handler = std::function<void(guard_violation, void*)>;
+
+    static constexpr std::uint64_t canary = 0x5AFEC0DE5AFEC0DEull;
+    static constexpr unsigned char poison = 0xDD;
+
+private:
+    struct header {
+        std::size_t bytes;
+        std::size_t alignment;
+        std::size_t prefix;
+        std::uint64_t front_canary;
+    };
+
+    std::pmr::memory_resource* upstream_;
+    std::size_t max_quarantine_bytes_;
+    std::size_t quarantined_bytes_;
+
+    // Копия заголовка, сделанная при выделении: заголовок может быть
+    // испорчен, а вернуть блок upstream нужно с верным размером
+    struct layout {
+        std::size_t bytes;
+        std::size_t alignment;
+        std::size_t prefix;
+    };
+
+    std::unordered_map<void*, layout> live_;
+    std::unordered_map<void*, layout> quarantined_;
+    std::deque<void*> quarantine_;
+    violation_handler handler_;
+
+    static header* header_of(void* p);
+    static std::size_t total_size(const layout& l);
+    static bool tail_intact(void* p, std::size_t bytes);
+
+    void report(guard_violation violation, void* p);
+    void release(void* p, const layout& l);
+    void evict_oldest();
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    explicit guarded_memory_resource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource(),
+                                     std::size_t max_quarantine_bytes = std::size_t(1) << 20);
+    ~guarded_memory_resource();
+
+    // Запрещаем копирование и перемещение
+    guarded_memory_resource(const guarded_memory_resource&) = delete;
+    guarded_memory_resource& operator=(const guarded_memory_resource&) = delete;
+
+    void set_violation_handler(violation_handler handler);
+
+    // Проверяет и возвращает upstream все блоки из карантина
+    void flush_quarantine();
+
+    std::size_t live_blocks() const;
+    std::size_t quarantined_bytes() const;
+};
@@ -0,0 +1,221 @@
+#pragma once
+#include <memory_resource>
+#include <functional>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "dynamic_array.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define HASH_INDEX_SSE2 1
+#endif
+
+// Хеш-индекс по ключу поверх существующего dynamic_array, например
+// поиск Person по name. Открытая адресация в духе SwissTable: массив
+// управляющих байт (0x80 - пусто, иначе 7 бит хеша) и массив индексов
+// элементов. Поиск сравнивает сразу группу из 16 управляющих байт
+// (SSE2), строки сравниваются только у кандидатов.
+//
+// Индекс хранит позиции, а не копии: после push_back в массив вызовите
+// sync() (добавит только новые элементы). Если массив стал короче,
+// sync() сам перестраивает индекс. Изменения на месте (erase, insert,
+// sort, запись по индексу), после которых размер не уменьшился,
+// sync() не замечает - после них нужен явный rebuild(). Таблицы
+// берутся из memory_resource массива.
+template<typename T, typename KeyFn>
+class hash_index {
+public:
+    using key_type = std::decay_t<std::invoke_result_t<KeyFn&, const T&>>;
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+private:
+    static constexpr std::size_t group_width = 16;
+    static constexpr std::uint8_t empty_slot = 0x80;
+
+    const dynamic_array<T>* source_;
+    KeyFn key_;
+    std::pmr::memory_resource* mr_;
+
+    std::uint8_t* ctrl_;
+    std::uint32_t* slots_;
+    std::size_t capacity_;
+    std::size_t count_;
+    std::size_t indexed_;
+
+    static std::size_t hash_of(const key_type& key) {
+        // Перемешиваем биты: std::hash для целых - тождественная функция
+        std::uint64_t h = static_cast<std::uint64_t>(std::hash<key_type>{}(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+    // Битовая маска позиций группы, где управляющий байт равен value
+    static std::uint32_t match(const std::uint8_t* group, std::uint8_t value) {
+#if defined(HASH_INDEX_SSE2)
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, pattern)));
+#else
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < group_width; ++i) {
+            if (group[i] == value) mask |= 1u << i;
+        }
+        return mask;
+#endif
+    }
+
+    static std::size_t lowest_bit(std::uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctz(mask));
+#else
+        std::size_t bit = 0;
+        while (!(mask & 1u)) {
+            mask >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    void allocate_tables(std::size_t capacity) {
+        capacity_ = capacity;
+        ctrl_ = static_cast<std::uint8_t*>(mr_->allocate(capacity_, group_width));
+        slots_ = static_cast<std::uint32_t*>(mr_->allocate(capacity_ * sizeof(std::uint32_t), alignof(std::uint32_t)));
+        std::memset(ctrl_, empty_slot, capacity_);
+        count_ = 0;
+    }
+
+    void free_tables() {
+        if (ctrl_) {
+            mr_->deallocate(ctrl_, capacity_, group_width);
+            mr_->deallocate(slots_, capacity_ * sizeof(std::uint32_t), alignof(std::uint32_t));
+        }
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = 0;
+        count_ = 0;
+    }
+
+    void insert_slot(std::size_t hash, std::uint32_t index) {
+        std::size_t groups = capacity_ / group_width;
+        std::size_t group = (hash >> 7) % groups;
+        while (true) {
+            std::uint8_t* ctrl = ctrl_ + group * group_width;
+            std::uint32_t empty = match(ctrl, empty_slot);
+            if (empty) {
+                std::size_t pos = group * group_width + lowest_bit(empty);
+                ctrl_[pos] = static_cast<std::uint8_t>(hash & 0x7F);
+                slots_[pos] = index;
+                ++count_;
+                return;
+            }
+            group = (group + 1) % groups;
+        }
+    }
+
+    void grow(std::size_t min_count) {
+        // Максимальная загрузка 7/8
+        std::size_t capacity = capacity_ ? capacity_ : group_width;
+        while (min_count * 8 > capacity * 7) {
+            capacity *= 2;
+        }
+        if (capacity == capacity_) return;
+
+        std::uint8_t* old_ctrl = ctrl_;
+        std::uint32_t* old_slots = slots_;
+        std::size_t old_capacity = capacity_;
+
+        allocate_tables(capacity);
+        for (std::size_t i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] != empty_slot) {
+                std::uint32_t index = old_slots[i];
+                insert_slot(hash_of(std::invoke(key_, (*source_)[index])), index);
+            }
+        }
+
+        if (old_ctrl) {
+            mr_->deallocate(old_ctrl, old_capacity, group_width);
+            mr_->deallocate(old_slots, old_capacity * sizeof(std::uint32_t), alignof(std::uint32_t));
+        }
+    }
+
+public:
+    // mr == nullptr: таблицы берутся из ресурса самого массива
+    hash_index(const dynamic_array<T>& source, KeyFn key, std::pmr::memory_resource* mr = nullptr)
+        : source_(&source), key_(std::move(key)), mr_(mr ? mr : source.resource()),
+          ctrl_(nullptr), slots_(nullptr), capacity_(0), count_(0), indexed_(0) {
+        sync();
+    }
+
+    ~hash_index() {
+        free_tables();
+    }
+
+    // Запрещаем копирование и перемещение для простоты
+    hash_index(const hash_index&) = delete;
+    hash_index& operator=(const hash_index&) = delete;
+
+    // Индексирует элементы, добавленные в массив после прошлого sync();
+    // если массив укоротился, старые позиции недействительны - перестраивает
+    void sync() {
+        std::size_t size = source_->size();
+        if (indexed_ > size) {
+            rebuild();
+            return;
+        }
+        if (indexed_ == size) return;
+
+        grow(count_ + (size - indexed_));
+        for (; indexed_ < size; ++indexed_) {
+            insert_slot(hash_of(std::invoke(key_, (*source_)[indexed_])),
+                        static_cast<std::uint32_t>(indexed_));
+        }
+    }
+
+    // Полная перестройка (после удаления или перестановки элементов)
+    void rebuild() {
+        free_tables();
+        indexed_ = 0;
+        sync();
+    }
+
+    // Позиция элемента с ключом key или npos
+    std::size_t index_of(const key_type& key) const {
+        if (count_ == 0) return npos;
+
+        std::size_t hash = hash_of(key);
+        std::uint8_t h2 = static_cast<std::uint8_t>(hash & 0x7F);
+        std::size_t groups = capacity_ / group_width;
+        std::size_t group = (hash >> 7) % groups;
+
+        for (std::size_t probes = 0; probes < groups; ++probes) {
+            const std::uint8_t* ctrl = ctrl_ + group * group_width;
+            for (std::uint32_t candidates = match(ctrl, h2); candidates; candidates &= candidates - 1) {
+                std::uint32_t index = slots_[group * group_width + lowest_bit(candidates)];
+                if (std::invoke(key_, (*source_)[index]) == key) {
+                    return index;
+                }
+            }
+            // Пустой слот в группе: дальше ключ искать бессмысленно
+            if (match(ctrl, empty_slot)) return npos;
+            group = (group + 1) % groups;
+        }
+        return npos;
+    }
+
+    const T* find(const key_type& key) const {
+        std::size_t index = index_of(key);
+        return index == npos ? nullptr : &(*source_)[index];
+    }
+
+    bool contains(const key_type& key) const {
+        return index_of(key) != npos;
+    }
+
+    std::size_t size() const { return count_; }
+    std::size_t bucket_count() const { return capacity_; }
+};
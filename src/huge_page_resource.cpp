@@ -0,0 +1,131 @@
+#include "huge_page_resource.h"
+#include <new>
+#include <cstdint>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+static std::size_t round_up(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+huge_page_resource::huge_page_resource(std::size_t region_size)
+    : region_size_(round_up(region_size ? region_size : huge_page_size, huge_page_size)),
+      current_region_(nullptr), current_(nullptr), remaining_(0) {}
+
+huge_page_resource::~huge_page_resource() {
+    for (const auto& entry : regions_) {
+        unmap_region(entry.second);
+    }
+    regions_.clear();
+}
+
+huge_page_resource::region huge_page_resource::map_region(std::size_t bytes, std::size_t alignment) {
+#if defined(__linux__)
+    // Берем с запасом в alignment (не меньше huge page) и обрезаем края,
+    // чтобы начало региона было выровнено как требуется
+    std::size_t mapped = bytes + alignment;
+    void* raw = mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+
+    char* start = static_cast<char*>(raw);
+    char* aligned = reinterpret_cast<char*>(
+        round_up(reinterpret_cast<std::uintptr_t>(start), alignment));
+    std::size_t head = static_cast<std::size_t>(aligned - start);
+    std::size_t tail = mapped - head - bytes;
+    if (head) munmap(start, head);
+    if (tail) munmap(aligned + bytes, tail);
+
+#if defined(MADV_HUGEPAGE)
+    // Ошибку игнорируем: без THP регион работает на обычных страницах
+    madvise(aligned, bytes, MADV_HUGEPAGE);
+#endif
+    return {aligned, bytes, 0, alignment, false};
+#else
+    // Без mmap просто выделяем выровненный регион
+    void* raw = ::operator new(bytes, std::align_val_t(alignment));
+    return {static_cast<char*>(raw), bytes, 0, alignment, false};
+#endif
+}
+
+void huge_page_resource::unmap_region(const region& r) {
+#if defined(__linux__)
+    munmap(r.base, r.size);
+#else
+    ::operator delete(r.base, std::align_val_t(r.alignment));
+#endif
+}
+
+void* huge_page_resource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    if (bytes == 0) bytes = 1;
+
+    // Крупные запросы получают собственный регион и не ломают текущий;
+    // общий регион выровнен только на huge page, поэтому более строгое
+    // выравнивание тоже требует своего региона
+    if (bytes > region_size_ / 2 || alignment > huge_page_size) {
+        region r = map_region(round_up(bytes, huge_page_size), std::max(alignment, huge_page_size));
+        r.live_blocks = 1;
+        r.dedicated = true;
+        regions_.emplace(r.base, r);
+        return r.base;
+    }
+
+    std::size_t padding = 0;
+    if (current_) {
+        padding = round_up(reinterpret_cast<std::uintptr_t>(current_), alignment) -
+                  reinterpret_cast<std::uintptr_t>(current_);
+    }
+
+    if (!current_ || padding + bytes > remaining_) {
+        region r = map_region(region_size_);
+        regions_.emplace(r.base, r);
+        current_region_ = r.base;
+        current_ = r.base;
+        remaining_ = r.size;
+        padding = 0;
+    }
+
+    char* ptr = current_ + padding;
+    current_ = ptr + bytes;
+    remaining_ -= padding + bytes;
+    ++region_of(ptr)->second.live_blocks;
+    return ptr;
+}
+
+std::map<char*, huge_page_resource::region>::iterator huge_page_resource::region_of(void* p) {
+    auto it = regions_.upper_bound(static_cast<char*>(p));
+    return --it;
+}
+
+void huge_page_resource::do_deallocate(void* p, std::size_t /*bytes*/, std::size_t /*alignment*/) {
+    auto it = region_of(p);
+    region& r = it->second;
+    if (--r.live_blocks > 0) return;
+
+    if (r.base == current_region_) {
+        // Текущий регион пуст: нарезаем его заново, не обращаясь к системе
+        current_ = r.base;
+        remaining_ = r.size;
+        return;
+    }
+
+    unmap_region(r);
+    regions_.erase(it);
+}
+
+bool huge_page_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+std::size_t huge_page_resource::reserved_bytes() const {
+    std::size_t total = 0;
+    for (const auto& entry : regions_) {
+        total += entry.second.size;
+    }
+    return total;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <memory_resource>
+#include <map>
+#include <cstddef>
+
+// Upstream-ресурс, который резервирует крупные регионы (по умолчанию 64 МБ),
+// выровненные на 2 МБ и помеченные madvise(MADV_HUGEPAGE), и нарезает их
+// последовательно. Так большие массивы попадают на huge pages и меньше
+// промахиваются в TLB. Запросы больше половины региона получают
+// собственный регион и возвращаются системе сразу при освобождении;
+// общий регион возвращается, когда освобождены все нарезанные из него
+// блоки. Поэтому ресурс можно сочетать с trim() и бюджетом
+// dynamic_memory_resource. Запросы с выравниванием больше 2 МБ тоже
+// получают собственный регион, выровненный как требуется.
+class huge_page_resource : public std::pmr::memory_resource {
+private:
+    struct region {
+        char* base;
+        std::size_t size;
+        std::size_t live_blocks;
+        std::size_t alignment;
+        bool dedicated;
+    };
+
+    // Ключ - начало региона, чтобы по указателю найти его регион
+    std::map<char*, region> regions_;
+    std::size_t region_size_;
+    char* current_region_;
+    char* current_;
+    std::size_t remaining_;
+
+    static region map_region(std::size_t bytes, std::size_t alignment = huge_page_size);
+    std::map<char*, region>::iterator region_of(void* p);
+    static void unmap_region(const region& r);
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    static constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+    explicit huge_page_resource(std::size_t region_size = std::size_t(64) << 20);
+    ~huge_page_resource();
+
+    // Запрещаем копирование и перемещение
+    huge_page_resource(const huge_page_resource&) = delete;
+    huge_page_resource& operator=(const huge_page_resource&) = delete;
+
+    // Сколько байт зарезервировано у системы
+    std::size_t reserved_bytes() const;
+};
@@ -13,36 +13,39 @@ public:
     using pointer = T*;
     using reference = T&;
 
-    dynamic_array_iterator(T* p = nullptr) : ptr(p) {}
+    constexpr dynamic_array_iterator(T* p = nullptr) : ptr(p) {}
 
     // Dereference
-    reference operator*() const { return *ptr; }
-    pointer operator->() const { return ptr; }
+    constexpr reference operator*() const { return *ptr; }
+    constexpr pointer operator->() const { return ptr; }
+
+    // Указатель на элемент (нужен контейнеру для erase/insert)
+    constexpr pointer base() const { return ptr; }
 
     // Prefix increment
-    dynamic_array_iterator& operator++() {
+    constexpr dynamic_array_iterator& operator++() {
         ++ptr;
         return *this;
     }
 
     // Postfix increment
-    dynamic_array_iterator operator++(int) {
+    constexpr dynamic_array_iterator operator++(int) {
         dynamic_array_iterator temp = *this;
         ++ptr;
         return temp;
     }
 
     // Comparison operators
-    bool operator==(const dynamic_array_iterator& other) const {
+    constexpr bool operator==(const dynamic_array_iterator& other) const {
         return ptr == other.ptr;
     }
 
-    bool operator!=(const dynamic_array_iterator& other) const {
+    constexpr bool operator!=(const dynamic_array_iterator& other) const {
         return ptr != other.ptr;
     }
 
     // Conversion for const_iterator
-    operator dynamic_array_iterator<const T>() const {
+    constexpr operator dynamic_array_iterator<const T>() const {
         return dynamic_array_iterator<const T>(ptr);
     }
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <iostream>
 #include "memory_resource.h"
 #include "dynamic_array.h"
+#include "scratch_arena.h"
 #include "person.h"  // Добавляем включение заголовка с Person
 
 void demo_simple_types() {
@@ -87,12 +88,34 @@ void demo_memory_reuse() {
     }
 }
 
+void demo_scratch_arena() {
+    std::cout << "\n=== DEMO SCRATCH ARENA ===" << std::endl;
+    
+    scratch_arena& arena = scratch_arena::local();
+    
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        // Checkpoint объявлен первым, поэтому разрушается последним
+        scratch_arena::checkpoint scope(arena);
+        
+        dynamic_array<int> temp(&arena);
+        for (int i = 0; i < 100; ++i) {
+            temp.push_back(i * iteration);
+        }
+        std::cout << "Iteration " << iteration << ": " << temp.size()
+                  << " elements, arena used " << arena.bytes_used()
+                  << " of " << arena.reserved_bytes() << " bytes" << std::endl;
+    }
+    
+    std::cout << "After all iterations arena used " << arena.bytes_used() << " bytes" << std::endl;
+}
+
 int main() {
     std::cout << "DYNAMIC ARRAY WITH CUSTOM MEMORY RESOURCE DEMO\n" << std::endl;
     
     demo_simple_types();
     demo_complex_types();
     demo_memory_reuse();
+    demo_scratch_arena();
     
     std::cout << "\n=== PROGRAM FINISHED ===" << std::endl;
     return 0;
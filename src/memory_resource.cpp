@@ -1,25 +1,131 @@
 #include "memory_resource.h"
 #include <iostream>
 #include <algorithm>
+#include <cstdint>
+#include <new>
 
-void* dynamic_memory_resource::do_allocate(std::size_t bytes, std::size_t /*alignment*/) {
+dynamic_memory_resource::dynamic_memory_resource(std::pmr::memory_resource* upstream)
+    : upstream_(upstream) {}
+
+std::pmr::memory_resource* dynamic_memory_resource::upstream_resource() const {
+    return upstream_;
+}
+
+void dynamic_memory_resource::release_block(const block_info& block) {
+    std::cout << "Released block: " << block.ptr << " size: " << block.size << std::endl;
+    upstream_->deallocate(block.ptr, block.size, block.alignment);
+}
+
+void dynamic_memory_resource::set_max_cached_bytes(std::size_t bytes, trim_order order) {
+    max_cached_bytes_ = bytes;
+    trim_order_ = order;
+    trim(max_cached_bytes_, trim_order_);
+}
+
+std::size_t dynamic_memory_resource::trim(std::size_t target, trim_order order) {
+    if (bytes_cached_ <= target) return 0;
+
+    // free_blocks пополняется с конца, поэтому самые старые блоки в начале;
+    // этот порядок не меняется, от него зависит повторное использование
+    std::vector<std::size_t> victims(free_blocks.size());
+    for (std::size_t i = 0; i < victims.size(); ++i) {
+        victims[i] = i;
+    }
+    if (order == trim_order::largest_first) {
+        // Сортируются индексы; stable_sort сохраняет возраст среди равных
+        std::stable_sort(victims.begin(), victims.end(),
+            [this](std::size_t a, std::size_t b) {
+                return free_blocks[a].size > free_blocks[b].size;
+            });
+    }
+
+    std::vector<bool> released_flags(free_blocks.size(), false);
+    std::size_t released = 0;
+    for (std::size_t i = 0; i < victims.size() && bytes_cached_ > target; ++i) {
+        const block_info& block = free_blocks[victims[i]];
+        release_block(block);
+        bytes_cached_ -= block.size;
+        released += block.size;
+        released_flags[victims[i]] = true;
+    }
+
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < free_blocks.size(); ++i) {
+        if (!released_flags[i]) {
+            free_blocks[kept++] = free_blocks[i];
+        }
+    }
+    free_blocks.resize(kept);
+    return released;
+}
+
+void dynamic_memory_resource::set_budget(std::size_t bytes, budget_handler handler) {
+    budget_ = bytes;
+    budget_handler_ = std::move(handler);
+}
+
+void dynamic_memory_resource::start_profiling(std::size_t sample_interval) {
+    profiler_ = std::make_unique<allocation_profiler>(sample_interval);
+}
+
+std::unique_ptr<allocation_profiler> dynamic_memory_resource::stop_profiling() {
+    return std::move(profiler_);
+}
+
+const allocation_profiler* dynamic_memory_resource::profiler() const {
+    return profiler_.get();
+}
+
+std::size_t dynamic_memory_resource::bytes_in_use() const {
+    return bytes_in_use_;
+}
+
+std::size_t dynamic_memory_resource::bytes_cached() const {
+    return bytes_cached_;
+}
+
+std::size_t dynamic_memory_resource::footprint() const {
+    return bytes_in_use_ + bytes_cached_;
+}
+
+void* dynamic_memory_resource::do_allocate(std::size_t bytes, std::size_t alignment) {
     // Сначала пытаемся найти подходящий блок в свободных блоках
     auto it = std::find_if(free_blocks.begin(), free_blocks.end(),
-        [bytes](const block_info& block) {
-            return block.size >= bytes;
+        [bytes, alignment](const block_info& block) {
+            return block.size >= bytes &&
+                   reinterpret_cast<std::uintptr_t>(block.ptr) % alignment == 0;
         });
     
     if (it != free_blocks.end()) {
         void* ptr = it->ptr;
-        allocated_blocks.push_back({ptr, bytes});
+        // Сохраняем реальный размер блока, чтобы вернуть его upstream целиком
+        allocated_blocks.push_back(*it);
+        bytes_cached_ -= it->size;
+        bytes_in_use_ += it->size;
         free_blocks.erase(it);
+        if (profiler_) profiler_->on_allocate(ptr, bytes);
         std::cout << "Reused block: " << ptr << " size: " << bytes << std::endl;
         return ptr;
     }
     
+    // Новый блок не должен выводить ресурс за бюджет: сначала отдаем
+    // закэшированные блоки, затем спрашиваем обработчик
+    if (budget_ != unlimited && (bytes > budget_ || footprint() > budget_ - bytes)) {
+        std::size_t excess = footprint() + bytes - budget_;
+        trim(bytes_cached_ > excess ? bytes_cached_ - excess : 0, trim_order_);
+        if (bytes > budget_ || footprint() > budget_ - bytes) {
+            if (!budget_handler_ || !budget_handler_(bytes, footprint())) {
+                throw std::bad_alloc();
+            }
+        }
+    }
+    
     // Если подходящего свободного блока нет, выделяем новый
-    void* ptr = ::operator new(bytes);
-    allocated_blocks.push_back({ptr, bytes});
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    void* ptr = upstream_->allocate(bytes, alignment);
+    allocated_blocks.push_back({ptr, bytes, alignment});
+    bytes_in_use_ += bytes;
+    if (profiler_) profiler_->on_allocate(ptr, bytes);
     std::cout << "Allocated new block: " << ptr << " size: " << bytes << std::endl;
     return ptr;
 }
@@ -33,8 +139,15 @@ void dynamic_memory_resource::do_deallocate(void* p, std::size_t /*bytes*/, std:
     
     if (it != allocated_blocks.end()) {
         free_blocks.push_back(*it);
+        bytes_in_use_ -= it->size;
+        bytes_cached_ += it->size;
         allocated_blocks.erase(it);
+        if (profiler_) profiler_->on_deallocate(p);
         std::cout << "Deallocated block: " << p << " moved to free list" << std::endl;
+        
+        if (bytes_cached_ > max_cached_bytes_) {
+            trim(max_cached_bytes_, trim_order_);
+        }
     }
 }
 
@@ -48,15 +161,17 @@ dynamic_memory_resource::~dynamic_memory_resource() {
     // Освобождаем все выделенные блоки
     for (const auto& block : allocated_blocks) {
         std::cout << "Cleaning up allocated block: " << block.ptr << std::endl;
-        ::operator delete(block.ptr);
+        upstream_->deallocate(block.ptr, block.size, block.alignment);
     }
     
     // Освобождаем все свободные блоки
     for (const auto& block : free_blocks) {
         std::cout << "Cleaning up free block: " << block.ptr << std::endl;
-        ::operator delete(block.ptr);
+        upstream_->deallocate(block.ptr, block.size, block.alignment);
     }
     
     allocated_blocks.clear();
     free_blocks.clear();
+    bytes_in_use_ = 0;
+    bytes_cached_ = 0;
 }
\ No newline at end of file
@@ -2,25 +2,85 @@
 #include <memory_resource>
 #include <vector>
 #include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include "allocation_profiler.h"
 
 class dynamic_memory_resource : public std::pmr::memory_resource {
+public:
+    // В каком порядке trim() возвращает свободные блоки upstream
+    enum class trim_order {
+        largest_first,
+        oldest_first
+    };
+    
+    // Вызывается, когда выделение превышает бюджет даже после trim().
+    // Вернуть true, чтобы все равно выделить память, false - бросить std::bad_alloc.
+    using budget_handler = std::function<bool(std::size_t requested, std::size_t footprint)>;
+    
+    static constexpr std::size_t unlimited = std::numeric_limits<std::size_t>::max();
+    
 private:
     struct block_info {
         void* ptr;
         std::size_t size;
+        std::size_t alignment;
     };
     
     std::vector<block_info> allocated_blocks;
     std::vector<block_info> free_blocks;
     
+    // Откуда берутся новые блоки, когда в free_blocks нет подходящего
+    std::pmr::memory_resource* upstream_;
+    
+    std::size_t bytes_in_use_ = 0;
+    std::size_t bytes_cached_ = 0;
+    std::size_t max_cached_bytes_ = unlimited;
+    trim_order trim_order_ = trim_order::largest_first;
+    std::size_t budget_ = unlimited;
+    budget_handler budget_handler_;
+    
+    // nullptr, пока профилирование выключено: цена - одна проверка указателя
+    std::unique_ptr<allocation_profiler> profiler_;
+    
+    void release_block(const block_info& block);
+    
     void* do_allocate(std::size_t bytes, std::size_t alignment) override;
     void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
     bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
     
 public:
-    dynamic_memory_resource() = default;
+    // По умолчанию блоки выделяются через ::operator new
+    explicit dynamic_memory_resource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
     ~dynamic_memory_resource();
     
+    std::pmr::memory_resource* upstream_resource() const;
+    
+    // Ограничение на объем закэшированных свободных блоков;
+    // излишек возвращается upstream сразу при освобождении в порядке order
+    // (он же используется при trim() из-за бюджета)
+    void set_max_cached_bytes(std::size_t bytes, trim_order order = trim_order::largest_first);
+    
+    // Возвращает upstream свободные блоки в порядке order, пока в кэше
+    // больше target байт. Порядок оставшихся блоков не меняется.
+    // Результат - число освобожденных байт.
+    std::size_t trim(std::size_t target = 0, trim_order order = trim_order::largest_first);
+    
+    // Жесткий лимит на память, взятую у upstream (занятую + закэшированную)
+    void set_budget(std::size_t bytes, budget_handler handler = nullptr);
+    
+    // Сэмплирующее профилирование мест выделения (примерно каждый
+    // sample_interval-й байт). stop_profiling() отдает собранные данные.
+    void start_profiling(std::size_t sample_interval);
+    std::unique_ptr<allocation_profiler> stop_profiling();
+    const allocation_profiler* profiler() const;
+    
+    // Статистика
+    std::size_t bytes_in_use() const;
+    std::size_t bytes_cached() const;
+    std::size_t footprint() const;
+    
     // Запрещаем копирование и перемещение
     dynamic_memory_resource(const dynamic_memory_resource&) = delete;
     dynamic_memory_resource& operator=(const dynamic_memory_resource&) = delete;
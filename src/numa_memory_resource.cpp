@@ -0,0 +1,169 @@
+#include "numa_memory_resource.h"
+#include <fstream>
+#include <string>
+#include <new>
+#include <cstdint>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#endif
+
+static std::size_t page_size() {
+#if defined(__linux__)
+    static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+static std::size_t round_up(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+int numa_node_count() {
+#if defined(__linux__)
+    // Формат: "0" или "0-1" (или список диапазонов "0-1,3")
+    static const int count = [] {
+        std::ifstream online("/sys/devices/system/node/online");
+        std::string text;
+        if (!std::getline(online, text) || text.empty()) return 1;
+
+        std::size_t pos = text.find_last_of(",-");
+        int last = std::stoi(pos == std::string::npos ? text : text.substr(pos + 1));
+        return last + 1;
+    }();
+    return count;
+#else
+    return 1;
+#endif
+}
+
+#if defined(__linux__)
+static bool apply_policy(void* p, std::size_t bytes, int mode, unsigned long mask, unsigned flags) {
+    unsigned long maxnode = sizeof(mask) * 8;
+    return syscall(SYS_mbind, p, bytes, mode, &mask, maxnode, flags) == 0;
+}
+
+static bool place_pages(void* p, std::size_t bytes, numa_policy policy, int node, unsigned flags) {
+    int nodes = std::min(numa_node_count(), static_cast<int>(sizeof(unsigned long) * 8));
+    switch (policy) {
+        case numa_policy::first_touch:
+            return true;
+        case numa_policy::bind:
+            return apply_policy(p, bytes, MPOL_BIND, 1ul << node, flags);
+        case numa_policy::interleave: {
+            unsigned long all = nodes == static_cast<int>(sizeof(unsigned long) * 8)
+                ? ~0ul : (1ul << nodes) - 1;
+            return apply_policy(p, bytes, MPOL_INTERLEAVE, all, flags);
+        }
+        case numa_policy::partition: {
+            // Равные непрерывные части, выровненные по страницам
+            std::size_t part = round_up((bytes + nodes - 1) / nodes, page_size());
+            bool ok = true;
+            char* begin = static_cast<char*>(p);
+            for (int n = 0; n < nodes; ++n) {
+                std::size_t offset = part * n;
+                if (offset >= bytes) break;
+                std::size_t length = std::min(part, bytes - offset);
+                ok = apply_policy(begin + offset, length, MPOL_BIND, 1ul << n, flags) && ok;
+            }
+            return ok;
+        }
+    }
+    return false;
+}
+#endif
+
+bool numa_place(void* p, std::size_t bytes, numa_policy policy, int node) {
+    // Маска узлов - одно слово, поэтому больше 64 узлов не адресуется
+    if (node < 0 || node >= numa_node_count() || node >= static_cast<int>(sizeof(unsigned long) * 8)) {
+        return false;
+    }
+#if defined(__linux__)
+    if (numa_node_count() <= 1 || policy == numa_policy::first_touch) return true;
+
+    // mbind работает только с целыми страницами
+    std::uintptr_t begin = round_up(reinterpret_cast<std::uintptr_t>(p), page_size());
+    std::uintptr_t end = (reinterpret_cast<std::uintptr_t>(p) + bytes) / page_size() * page_size();
+    if (end <= begin) return true;
+
+    return place_pages(reinterpret_cast<void*>(begin), end - begin, policy, node, MPOL_MF_MOVE);
+#else
+    (void)p; (void)bytes; (void)policy; (void)node;
+    return true;
+#endif
+}
+
+numa_memory_resource::numa_memory_resource(numa_policy policy, int node)
+    : policy_(policy),
+      node_(node >= 0 && node < numa_node_count() && node < static_cast<int>(sizeof(unsigned long) * 8) ? node : 0),
+      failed_placements_(0) {}
+
+void* numa_memory_resource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if defined(__linux__)
+    std::size_t length = round_up(bytes ? bytes : 1, page_size());
+
+    // mmap гарантирует только выравнивание по странице: для большего
+    // берем с запасом и обрезаем края
+    std::size_t extra = alignment > page_size() ? alignment : 0;
+    void* raw = mmap(nullptr, length + extra, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+
+    void* p = raw;
+    if (extra) {
+        char* start = static_cast<char*>(raw);
+        char* aligned = reinterpret_cast<char*>(round_up(reinterpret_cast<std::uintptr_t>(start), alignment));
+        std::size_t head = static_cast<std::size_t>(aligned - start);
+        std::size_t tail = extra - head;
+        if (head) munmap(start, head);
+        if (tail) munmap(aligned + length, tail);
+        p = aligned;
+    }
+
+    if (policy_ == numa_policy::first_touch) {
+        // Страница размещается на узле потока, который первым в нее пишет
+        char* page = static_cast<char*>(p);
+        for (std::size_t offset = 0; offset < length; offset += page_size()) {
+            page[offset] = 0;
+        }
+    } else if (numa_node_count() > 1 && !place_pages(p, length, policy_, node_, 0)) {
+        ++failed_placements_;
+    }
+    return p;
+#else
+    return ::operator new(bytes, std::align_val_t(std::max(alignment, alignof(std::max_align_t))));
+#endif
+}
+
+void numa_memory_resource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+#if defined(__linux__)
+    munmap(p, round_up(bytes ? bytes : 1, page_size()));
+    (void)alignment;
+#else
+    ::operator delete(p, std::align_val_t(std::max(alignment, alignof(std::max_align_t))));
+    (void)bytes;
+#endif
+}
+
+bool numa_memory_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+numa_policy numa_memory_resource::policy() const {
+    return policy_;
+}
+
+int numa_memory_resource::node() const {
+    return node_;
+}
+
+std::size_t numa_memory_resource::failed_placements() const {
+    return failed_placements_;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <memory_resource>
+#include <cstddef>
+#include "dynamic_array.h"
+
+// Политика размещения страниц по NUMA-узлам
+enum class numa_policy {
+    first_touch,  // страницы затрагиваются потоком-владельцем при выделении
+    bind,         // все страницы на заданном узле
+    interleave,   // страницы по кругу на всех узлах
+    partition     // диапазон режется на равные непрерывные части по узлам
+};
+
+// Число NUMA-узлов (1 на машинах без NUMA и вне Linux)
+int numa_node_count();
+
+// Применяет политику к страницам, целиком лежащим внутри [p, p + bytes).
+// Уже размещенные страницы переносятся. Возвращает false для
+// несуществующего узла или если ядро отказало (нет прав) - память при
+// этом остается рабочей.
+bool numa_place(void* p, std::size_t bytes, numa_policy policy, int node = 0);
+
+// Размещение хранилища существующего массива (например, interleave для
+// массива, который сканируют рабочие потоки с обоих сокетов)
+template<typename T>
+bool numa_place(dynamic_array<T>& arr, numa_policy policy, int node = 0) {
+    if (arr.capacity() == 0) return true;
+    return numa_place(&arr[0], arr.capacity() * sizeof(T), policy, node);
+}
+
+// Ресурс, который выделяет каждый блок отдельным mmap и размещает его
+// страницы по выбранной политике через mbind. Предназначен как upstream
+// для dynamic_memory_resource или для крупных массивов напрямую.
+// На одном узле и вне Linux политика не применяется, а bind/interleave/
+// partition сводятся к обычному выделению.
+class numa_memory_resource : public std::pmr::memory_resource {
+private:
+    numa_policy policy_;
+    int node_;
+    std::size_t failed_placements_;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    explicit numa_memory_resource(numa_policy policy = numa_policy::first_touch, int node = 0);
+
+    // Запрещаем копирование и перемещение
+    numa_memory_resource(const numa_memory_resource&) = delete;
+    numa_memory_resource& operator=(const numa_memory_resource&) = delete;
+
+    numa_policy policy() const;
+    int node() const;
+
+    // Сколько раз ядро отказало в mbind (для диагностики)
+    std::size_t failed_placements() const;
+};
@@ -0,0 +1,151 @@
+#pragma once
+#include <memory_resource>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+
+// Беззнаковое представление ключа, сохраняющее порядок
+template<typename K, typename = void>
+struct radix_key;
+
+template<typename K>
+struct radix_key<K, std::enable_if_t<std::is_integral_v<K> && !std::is_same_v<K, bool>>> {
+    using type = std::make_unsigned_t<K>;
+
+    static type encode(K value) {
+        type bits = static_cast<type>(value);
+        if constexpr (std::is_signed_v<K>) {
+            // Инвертируем знаковый бит: отрицательные уходят вперед
+            bits ^= type(1) << (sizeof(type) * 8 - 1);
+        }
+        return bits;
+    }
+
+    static K decode(type bits) {
+        if constexpr (std::is_signed_v<K>) {
+            bits ^= type(1) << (sizeof(type) * 8 - 1);
+        }
+        return static_cast<K>(bits);
+    }
+};
+
+template<typename K>
+struct radix_key<K, std::enable_if_t<std::is_floating_point_v<K>>> {
+    static_assert(sizeof(K) == 4 || sizeof(K) == 8, "unsupported floating point type");
+    using type = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+
+    static constexpr type sign_bit = type(1) << (sizeof(type) * 8 - 1);
+
+    static type encode(K value) {
+        type bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        // Отрицательные числа: инвертируем все биты, положительные: только знак
+        return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+    }
+
+    static K decode(type bits) {
+        bits = (bits & sign_bit) ? (bits & ~sign_bit) : ~bits;
+        K value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+};
+
+template<typename K>
+using radix_key_t = typename radix_key<K>::type;
+
+// Пара "ключ + исходная позиция" для сортировки по ключу
+template<typename U>
+struct radix_pair {
+    U key;
+    std::size_t index;
+};
+
+// Временный буфер из заданного memory_resource
+template<typename U>
+class scratch_buffer {
+private:
+    std::pmr::polymorphic_allocator<U> allocator_;
+    U* data_;
+    std::size_t size_;
+
+public:
+    scratch_buffer(std::size_t n, std::pmr::memory_resource* mr)
+        : allocator_(mr), data_(n ? allocator_.allocate(n) : nullptr), size_(n) {}
+
+    ~scratch_buffer() {
+        if (data_) {
+            allocator_.deallocate(data_, size_);
+        }
+    }
+
+    scratch_buffer(const scratch_buffer&) = delete;
+    scratch_buffer& operator=(const scratch_buffer&) = delete;
+
+    U* data() { return data_; }
+};
+
+// LSD-сортировка по байтам. Гистограммы всех разрядов строятся за один
+// проход; разряды, в которых все ключи совпадают, пропускаются.
+// Результат остается в items, scratch используется как второй буфер.
+template<typename Item, typename KeyOf>
+void radix_sort(Item* items, Item* scratch, std::size_t n, KeyOf key_of) {
+    using U = std::decay_t<decltype(key_of(*items))>;
+    constexpr std::size_t passes = sizeof(U);
+
+    if (n < 2) return;
+
+    std::size_t counts[passes][256] = {};
+    for (std::size_t i = 0; i < n; ++i) {
+        U key = key_of(items[i]);
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            ++counts[pass][(key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    Item* src = items;
+    Item* dst = scratch;
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        std::size_t* count = counts[pass];
+        if (count[(key_of(src[0]) >> (pass * 8)) & 0xFF] == n) continue;
+
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit < 256; ++digit) {
+            std::size_t c = count[digit];
+            count[digit] = offset;
+            offset += c;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            dst[count[(key_of(src[i]) >> (pass * 8)) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != items) {
+        std::memcpy(items, src, n * sizeof(Item));
+    }
+}
+
+// Устойчивая восходящая сортировка слиянием для ключей, которые нельзя
+// сортировать поразрядно (строки и т.п.). Вся временная память - scratch,
+// поэтому она берется из того же ресурса, что и остальные буферы.
+template<typename Item, typename Less>
+void merge_sort(Item* items, Item* scratch, std::size_t n, Less less) {
+    Item* src = items;
+    Item* dst = scratch;
+    for (std::size_t width = 1; width < n; width *= 2) {
+        for (std::size_t lo = 0; lo < n; lo += 2 * width) {
+            std::size_t mid = std::min(lo + width, n);
+            std::size_t hi = std::min(lo + 2 * width, n);
+            std::merge(src + lo, src + mid, src + mid, src + hi, dst + lo, less);
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != items) {
+        std::copy(src, src + n, items);
+    }
+}
@@ -0,0 +1,513 @@
+#pragma once
+#include <memory_resource>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include "dynamic_array.h"
+
+// Ленивые адаптеры поверх dynamic_array и других диапазонов с begin()/end().
+// Цепочка filter -> transform -> take выполняется за один проход без
+// промежуточных массивов:
+//
+//   double total = people
+//       | views::filter([](const Person& p) { return p.age > 30; })
+//       | views::transform([](const Person& p) { return p.salary; })
+//       | views::reduce(0.0, std::plus<>());
+//
+// Контейнер-lvalue хранится по указателю и должен пережить view.
+namespace views {
+
+template<typename It>
+using iter_reference_t = decltype(*std::declval<It&>());
+
+template<typename It>
+using iter_value_t = std::remove_cv_t<std::remove_reference_t<iter_reference_t<It>>>;
+
+template<typename R>
+using range_iterator_t = decltype(std::declval<R&>().begin());
+
+// Верхняя оценка числа элементов: size_hint() у view, size() у контейнера
+template<typename R, typename = void>
+struct has_size_hint : std::false_type {};
+template<typename R>
+struct has_size_hint<R, std::void_t<decltype(std::declval<const R&>().size_hint())>> : std::true_type {};
+
+template<typename R, typename = void>
+struct has_size : std::false_type {};
+template<typename R>
+struct has_size<R, std::void_t<decltype(std::declval<const R&>().size())>> : std::true_type {};
+
+template<typename R>
+std::size_t size_hint_of(const R& r) {
+    if constexpr (has_size_hint<R>::value) {
+        return r.size_hint();
+    } else if constexpr (has_size<R>::value) {
+        return r.size();
+    } else {
+        return 0;
+    }
+}
+
+// Невладеющая ссылка на контейнер
+template<typename C>
+class ref_view {
+private:
+    C* container_;
+
+public:
+    explicit ref_view(C& container) : container_(&container) {}
+
+    auto begin() const { return container_->begin(); }
+    auto end() const { return container_->end(); }
+    std::size_t size_hint() const { return size_hint_of(*container_); }
+};
+
+template<typename R>
+auto make_source(R&& r) {
+    if constexpr (std::is_lvalue_reference_v<R>) {
+        return ref_view<std::remove_reference_t<R>>(r);
+    } else {
+        return std::decay_t<R>(std::move(r));
+    }
+}
+
+template<typename R>
+using source_t = decltype(make_source(std::declval<R>()));
+
+// Пара итераторов как диапазон (элемент chunk_view)
+template<typename It>
+class subrange {
+private:
+    It begin_;
+    It end_;
+    std::size_t size_;
+
+public:
+    subrange(It first, It last, std::size_t size) : begin_(first), end_(last), size_(size) {}
+
+    It begin() const { return begin_; }
+    It end() const { return end_; }
+    std::size_t size() const { return size_; }
+};
+
+template<typename Base, typename Pred>
+class filter_view {
+private:
+    Base base_;
+    Pred pred_;
+
+public:
+    using base_iterator = range_iterator_t<Base>;
+
+    class iterator {
+    private:
+        base_iterator it_;
+        base_iterator end_;
+        Pred* pred_;
+
+        void satisfy() {
+            while (it_ != end_ && !std::invoke(*pred_, *it_)) ++it_;
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = iter_value_t<base_iterator>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = iter_reference_t<base_iterator>;
+
+        iterator() : pred_(nullptr) {}
+        iterator(base_iterator it, base_iterator end, Pred* pred) : it_(it), end_(end), pred_(pred) {
+            satisfy();
+        }
+
+        reference operator*() const { return *it_; }
+
+        iterator& operator++() {
+            ++it_;
+            satisfy();
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const { return it_ == other.it_; }
+        bool operator!=(const iterator& other) const { return it_ != other.it_; }
+    };
+
+    filter_view(Base base, Pred pred) : base_(std::move(base)), pred_(std::move(pred)) {}
+
+    iterator begin() { return iterator(base_.begin(), base_.end(), &pred_); }
+    iterator end() { return iterator(base_.end(), base_.end(), &pred_); }
+    std::size_t size_hint() const { return size_hint_of(base_); }
+};
+
+template<typename Base, typename Fn>
+class transform_view {
+private:
+    Base base_;
+    Fn fn_;
+
+public:
+    using base_iterator = range_iterator_t<Base>;
+
+    class iterator {
+    private:
+        base_iterator it_;
+        Fn* fn_;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using reference = std::invoke_result_t<Fn&, iter_reference_t<base_iterator>>;
+        using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+
+        iterator() : fn_(nullptr) {}
+        iterator(base_iterator it, Fn* fn) : it_(it), fn_(fn) {}
+
+        reference operator*() const { return std::invoke(*fn_, *it_); }
+
+        iterator& operator++() {
+            ++it_;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++it_;
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const { return it_ == other.it_; }
+        bool operator!=(const iterator& other) const { return it_ != other.it_; }
+    };
+
+    transform_view(Base base, Fn fn) : base_(std::move(base)), fn_(std::move(fn)) {}
+
+    iterator begin() { return iterator(base_.begin(), &fn_); }
+    iterator end() { return iterator(base_.end(), &fn_); }
+    std::size_t size_hint() const { return size_hint_of(base_); }
+};
+
+template<typename Base>
+class take_view {
+private:
+    Base base_;
+    std::size_t count_;
+
+public:
+    using base_iterator = range_iterator_t<Base>;
+
+    class iterator {
+    private:
+        base_iterator it_;
+        base_iterator end_;
+        std::size_t remaining_;
+
+        bool at_end() const { return remaining_ == 0 || it_ == end_; }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = iter_value_t<base_iterator>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = iter_reference_t<base_iterator>;
+
+        iterator() : remaining_(0) {}
+        iterator(base_iterator it, base_iterator end, std::size_t remaining)
+            : it_(it), end_(end), remaining_(remaining) {}
+
+        reference operator*() const { return *it_; }
+
+        iterator& operator++() {
+            ++it_;
+            --remaining_;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const {
+            if (at_end() || other.at_end()) return at_end() == other.at_end();
+            return it_ == other.it_;
+        }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+
+    take_view(Base base, std::size_t count) : base_(std::move(base)), count_(count) {}
+
+    iterator begin() { return iterator(base_.begin(), base_.end(), count_); }
+    iterator end() { return iterator(base_.end(), base_.end(), 0); }
+    std::size_t size_hint() const { return std::min(count_, size_hint_of(base_)); }
+};
+
+template<typename First, typename Second>
+class zip_view {
+private:
+    First first_;
+    Second second_;
+
+public:
+    using first_iterator = range_iterator_t<First>;
+    using second_iterator = range_iterator_t<Second>;
+
+    class iterator {
+    private:
+        first_iterator first_;
+        first_iterator first_end_;
+        second_iterator second_;
+        second_iterator second_end_;
+
+        bool at_end() const { return first_ == first_end_ || second_ == second_end_; }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using reference = std::pair<iter_reference_t<first_iterator>, iter_reference_t<second_iterator>>;
+        using value_type = reference;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+
+        iterator() = default;
+        iterator(first_iterator first, first_iterator first_end,
+                 second_iterator second, second_iterator second_end)
+            : first_(first), first_end_(first_end), second_(second), second_end_(second_end) {}
+
+        reference operator*() const { return reference(*first_, *second_); }
+
+        iterator& operator++() {
+            ++first_;
+            ++second_;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const {
+            if (at_end() || other.at_end()) return at_end() == other.at_end();
+            return first_ == other.first_;
+        }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+
+    zip_view(First first, Second second) : first_(std::move(first)), second_(std::move(second)) {}
+
+    iterator begin() { return iterator(first_.begin(), first_.end(), second_.begin(), second_.end()); }
+    iterator end() { return iterator(first_.end(), first_.end(), second_.end(), second_.end()); }
+    std::size_t size_hint() const { return std::min(size_hint_of(first_), size_hint_of(second_)); }
+};
+
+template<typename Base>
+class chunk_view {
+private:
+    Base base_;
+    std::size_t size_;
+
+public:
+    using base_iterator = range_iterator_t<Base>;
+
+    class iterator {
+    private:
+        base_iterator it_;
+        base_iterator end_;
+        std::size_t size_;
+
+        std::pair<base_iterator, std::size_t> chunk_end() const {
+            base_iterator next = it_;
+            std::size_t count = 0;
+            while (count < size_ && next != end_) {
+                ++next;
+                ++count;
+            }
+            return {next, count};
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = subrange<base_iterator>;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+
+        iterator() : size_(0) {}
+        iterator(base_iterator it, base_iterator end, std::size_t size) : it_(it), end_(end), size_(size) {}
+
+        reference operator*() const {
+            auto last = chunk_end();
+            return value_type(it_, last.first, last.second);
+        }
+
+        iterator& operator++() {
+            it_ = chunk_end().first;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const { return it_ == other.it_; }
+        bool operator!=(const iterator& other) const { return it_ != other.it_; }
+    };
+
+    chunk_view(Base base, std::size_t size) : base_(std::move(base)), size_(size ? size : 1) {}
+
+    iterator begin() { return iterator(base_.begin(), base_.end(), size_); }
+    iterator end() { return iterator(base_.end(), base_.end(), size_); }
+    std::size_t size_hint() const { return (size_hint_of(base_) + size_ - 1) / size_; }
+};
+
+// Адаптеры для записи через "|"
+struct adaptor_closure {};
+
+template<typename R, typename Adaptor,
+         typename = std::enable_if_t<std::is_base_of_v<adaptor_closure, std::decay_t<Adaptor>>>>
+auto operator|(R&& r, Adaptor&& adaptor) {
+    return std::forward<Adaptor>(adaptor)(std::forward<R>(r));
+}
+
+template<typename Pred>
+struct filter_adaptor : adaptor_closure {
+    Pred pred;
+
+    template<typename R>
+    auto operator()(R&& r) const {
+        return filter_view<source_t<R>, Pred>(make_source(std::forward<R>(r)), pred);
+    }
+};
+
+template<typename Fn>
+struct transform_adaptor : adaptor_closure {
+    Fn fn;
+
+    template<typename R>
+    auto operator()(R&& r) const {
+        return transform_view<source_t<R>, Fn>(make_source(std::forward<R>(r)), fn);
+    }
+};
+
+struct take_adaptor : adaptor_closure {
+    std::size_t count;
+
+    template<typename R>
+    auto operator()(R&& r) const {
+        return take_view<source_t<R>>(make_source(std::forward<R>(r)), count);
+    }
+};
+
+struct chunk_adaptor : adaptor_closure {
+    std::size_t size;
+
+    template<typename R>
+    auto operator()(R&& r) const {
+        return chunk_view<source_t<R>>(make_source(std::forward<R>(r)), size);
+    }
+};
+
+template<typename Other>
+struct zip_adaptor : adaptor_closure {
+    Other other;
+
+    // Как filter/transform, адаптер можно применять повторно: other
+    // копируется (для lvalue это ref_view). Временный адаптер отдает
+    // other перемещением, поэтому zip с временным массивом тоже работает
+    template<typename R>
+    auto operator()(R&& r) const& {
+        return zip_view<source_t<R>, Other>(make_source(std::forward<R>(r)), other);
+    }
+
+    template<typename R>
+    auto operator()(R&& r) && {
+        return zip_view<source_t<R>, Other>(make_source(std::forward<R>(r)), std::move(other));
+    }
+};
+
+template<typename T, typename Op>
+struct reduce_adaptor : adaptor_closure {
+    T init;
+    Op op;
+
+    template<typename R>
+    T operator()(R&& r) const {
+        T result = init;
+        for (auto&& value : r) {
+            result = std::invoke(op, std::move(result), std::forward<decltype(value)>(value));
+        }
+        return result;
+    }
+};
+
+struct collect_adaptor : adaptor_closure {
+    std::pmr::memory_resource* mr;
+
+    // Материализует диапазон в dynamic_array из ресурса mr, заранее
+    // зарезервировав верхнюю оценку размера. Тип элемента должен быть
+    // одним из явно инстанцированных в dynamic_array.cpp.
+    template<typename R>
+    auto operator()(R&& r) const {
+        using value_type = iter_value_t<range_iterator_t<std::remove_reference_t<R>>>;
+        dynamic_array<value_type> result(mr);
+        result.reserve(size_hint_of(r));
+        for (auto&& value : r) {
+            result.push_back(std::forward<decltype(value)>(value));
+        }
+        return result;
+    }
+};
+
+template<typename Pred>
+filter_adaptor<Pred> filter(Pred pred) {
+    return {{}, std::move(pred)};
+}
+
+template<typename Fn>
+transform_adaptor<Fn> transform(Fn fn) {
+    return {{}, std::move(fn)};
+}
+
+inline take_adaptor take(std::size_t count) {
+    return {{}, count};
+}
+
+inline chunk_adaptor chunk(std::size_t size) {
+    return {{}, size};
+}
+
+template<typename R>
+zip_adaptor<source_t<R>> zip(R&& other) {
+    return {{}, make_source(std::forward<R>(other))};
+}
+
+template<typename R1, typename R2>
+auto zip(R1&& first, R2&& second) {
+    return zip_view<source_t<R1>, source_t<R2>>(make_source(std::forward<R1>(first)),
+                                                make_source(std::forward<R2>(second)));
+}
+
+template<typename T, typename Op>
+reduce_adaptor<T, Op> reduce(T init, Op op) {
+    return {{}, std::move(init), std::move(op)};
+}
+
+inline collect_adaptor collect(std::pmr::memory_resource* mr = std::pmr::get_default_resource()) {
+    return {{}, mr};
+}
+
+}
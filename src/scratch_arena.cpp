@@ -0,0 +1,90 @@
+#include "scratch_arena.h"
+#include <algorithm>
+#include <cstdint>
+
+static std::size_t align_offset(const char* base, std::size_t offset, std::size_t alignment) {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(base) + offset;
+    std::uintptr_t aligned = (address + alignment - 1) / alignment * alignment;
+    return offset + static_cast<std::size_t>(aligned - address);
+}
+
+scratch_arena::checkpoint::checkpoint(scratch_arena& arena)
+    : arena_(arena), chunk_(arena.current_), offset_(arena.offset_) {}
+
+scratch_arena::checkpoint::~checkpoint() {
+    rewind();
+}
+
+void scratch_arena::checkpoint::rewind() {
+    arena_.current_ = chunk_;
+    arena_.offset_ = offset_;
+}
+
+scratch_arena::scratch_arena(std::size_t chunk_size, std::pmr::memory_resource* upstream)
+    : upstream_(upstream), chunk_size_(chunk_size ? chunk_size : 1), current_(0), offset_(0) {}
+
+scratch_arena::~scratch_arena() {
+    release();
+}
+
+scratch_arena& scratch_arena::local() {
+    static thread_local scratch_arena arena;
+    return arena;
+}
+
+void* scratch_arena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    // Текущий чанк, затем уже выделенные ранее чанки за ним
+    while (current_ < chunks_.size()) {
+        const chunk& c = chunks_[current_];
+        std::size_t start = align_offset(c.base, offset_, alignment);
+        if (start + bytes <= c.size) {
+            offset_ = start + bytes;
+            return c.base + start;
+        }
+        ++current_;
+        offset_ = 0;
+    }
+
+    // Новый чанк растет геометрически, чтобы число чанков оставалось малым
+    std::size_t size = std::max(bytes + alignment, chunks_.empty() ? chunk_size_ : chunks_.back().size * 2);
+    char* base = static_cast<char*>(upstream_->allocate(size, alignof(std::max_align_t)));
+    chunks_.push_back({base, size});
+    current_ = chunks_.size() - 1;
+
+    std::size_t start = align_offset(base, 0, alignment);
+    offset_ = start + bytes;
+    return base + start;
+}
+
+void scratch_arena::do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) {
+    // Память возвращается откатом checkpoint
+}
+
+bool scratch_arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void scratch_arena::release() {
+    for (const auto& c : chunks_) {
+        upstream_->deallocate(c.base, c.size, alignof(std::max_align_t));
+    }
+    chunks_.clear();
+    current_ = 0;
+    offset_ = 0;
+}
+
+std::size_t scratch_arena::bytes_used() const {
+    std::size_t used = offset_;
+    for (std::size_t i = 0; i < current_ && i < chunks_.size(); ++i) {
+        used += chunks_[i].size;
+    }
+    return used;
+}
+
+std::size_t scratch_arena::reserved_bytes() const {
+    std::size_t total = 0;
+    for (const auto& c : chunks_) {
+        total += c.size;
+    }
+    return total;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <memory_resource>
+#include <vector>
+#include <cstddef>
+
+// Арена для временных массивов в горячих циклах. Выделение - сдвиг
+// указателя, освобождение отдельного блока ничего не делает, а
+// checkpoint при выходе из области видимости откатывает арену к
+// запомненной позиции за O(1). Чанки не возвращаются upstream, поэтому
+// следующие итерации работают без обращений к upstream.
+//
+//   for (...) {
+//       scratch_arena::checkpoint scope(scratch_arena::local());
+//       dynamic_array<int> tmp(&scratch_arena::local());
+//       ...
+//   } // tmp разрушен, память арены откатана
+//
+// Массивы внутри области должны быть разрушены до checkpoint
+// (объявляйте checkpoint первым).
+class scratch_arena : public std::pmr::memory_resource {
+private:
+    struct chunk {
+        char* base;
+        std::size_t size;
+    };
+
+    std::pmr::memory_resource* upstream_;
+    std::size_t chunk_size_;
+    std::vector<chunk> chunks_;
+    std::size_t current_;
+    std::size_t offset_;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    class checkpoint {
+    private:
+        scratch_arena& arena_;
+        std::size_t chunk_;
+        std::size_t offset_;
+
+    public:
+        explicit checkpoint(scratch_arena& arena);
+        ~checkpoint();
+
+        checkpoint(const checkpoint&) = delete;
+        checkpoint& operator=(const checkpoint&) = delete;
+
+        // Откат без выхода из области видимости
+        void rewind();
+    };
+
+    explicit scratch_arena(std::size_t chunk_size = std::size_t(64) << 10,
+                           std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    ~scratch_arena();
+
+    // Запрещаем копирование и перемещение
+    scratch_arena(const scratch_arena&) = delete;
+    scratch_arena& operator=(const scratch_arena&) = delete;
+
+    // Арена текущего потока
+    static scratch_arena& local();
+
+    // Возвращает все чанки upstream (живых объектов в арене быть не должно)
+    void release();
+
+    std::size_t bytes_used() const;
+    std::size_t reserved_bytes() const;
+};
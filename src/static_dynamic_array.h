@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include "iterator.h"
+
+// Массив с емкостью N, заданной на этапе компиляции. Тот же интерфейс,
+// что у dynamic_array, но хранилище встроено в объект: нет
+// polymorphic_allocator и виртуальных вызовов memory_resource.
+// Все операции constexpr, поэтому для литеральных T массив можно
+// заполнять и обходить в константных выражениях.
+//
+// В C++17 нельзя создавать объекты в неинициализированной памяти в
+// constexpr, поэтому все N элементов сразу default-конструируются, а
+// push_back присваивает значение; T должен быть default-constructible.
+template<typename T, std::size_t N>
+class static_dynamic_array {
+    static_assert(N > 0, "static_dynamic_array capacity must be positive");
+
+private:
+    T data_[N]{};
+    std::size_t size_ = 0;
+
+public:
+    using iterator = dynamic_array_iterator<T>;
+    using const_iterator = dynamic_array_iterator<const T>;
+
+    constexpr static_dynamic_array() = default;
+
+    // Доступ к элементам
+    constexpr T& operator[](std::size_t index) { return data_[index]; }
+    constexpr const T& operator[](std::size_t index) const { return data_[index]; }
+
+    // Размер и емкость
+    constexpr std::size_t size() const { return size_; }
+    static constexpr std::size_t capacity() { return N; }
+    constexpr bool empty() const { return size_ == 0; }
+    constexpr bool full() const { return size_ == N; }
+
+    // Добавление элементов; при переполнении бросает std::length_error
+    // (в константном выражении это ошибка компиляции)
+    constexpr void push_back(const T& value) {
+        if (size_ >= N) throw std::length_error("static_dynamic_array is full");
+        data_[size_++] = value;
+    }
+
+    constexpr void push_back(T&& value) {
+        if (size_ >= N) throw std::length_error("static_dynamic_array is full");
+        data_[size_++] = std::move(value);
+    }
+
+    // Удаление: освободившийся слот сбрасывается в T{}
+    constexpr void pop_back() {
+        data_[--size_] = T{};
+    }
+
+    constexpr void clear() {
+        while (size_ > 0) {
+            pop_back();
+        }
+    }
+
+    // Итераторы
+    constexpr iterator begin() { return iterator(data_); }
+    constexpr iterator end() { return iterator(data_ + size_); }
+    constexpr const_iterator begin() const { return const_iterator(data_); }
+    constexpr const_iterator end() const { return const_iterator(data_ + size_); }
+    constexpr const_iterator cbegin() const { return const_iterator(data_); }
+    constexpr const_iterator cend() const { return const_iterator(data_ + size_); }
+};
@@ -1,13 +1,34 @@
 #include <gtest/gtest.h>
 #include "../src/memory_resource.h"
+#include "../src/huge_page_resource.h"
+#include "../src/guarded_memory_resource.h"
+#include "../src/scratch_arena.h"
+#include "../src/numa_memory_resource.h"
 #include "../src/dynamic_array.h"
+#include "../src/concurrent_dynamic_array.h"
+#include "../src/cow_dynamic_array.h"
+#include "../src/static_dynamic_array.h"
 #include "../src/iterator.h"
+#include "../src/range_views.h"
+#include "../src/hash_index.h"
+#include "../src/compressed_int_array.h"
+#include "../src/chunked_loader.h"
 #include "../src/person.h"
 #include "../src/test_struct.h"  // Включаем вместо локального определения
 #include <memory>
 #include <string>
 #include <algorithm>
 #include <vector>
+#include <thread>
+#include <cstdint>
+#include <limits>
+#include <fstream>
+#include <cstdio>
+#include <stdexcept>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <cstring>
 
 // Убираем локальное определение TestStruct, используем из test_struct.h
 
@@ -154,6 +175,533 @@ TEST_F(MemoryResourceTest, AllocationFailureHandling) {
     });
 }
 
+TEST_F(MemoryResourceTest, DefaultUpstreamIsNewDelete) {
+    EXPECT_EQ(mr->upstream_resource(), std::pmr::new_delete_resource());
+}
+
+TEST_F(MemoryResourceTest, FootprintStatistics) {
+    void* ptr = mr->allocate(100);
+    EXPECT_EQ(mr->bytes_in_use(), 100);
+    EXPECT_EQ(mr->bytes_cached(), 0);
+
+    mr->deallocate(ptr, 100);
+    EXPECT_EQ(mr->bytes_in_use(), 0);
+    EXPECT_EQ(mr->bytes_cached(), 100);
+    EXPECT_EQ(mr->footprint(), 100);
+}
+
+TEST_F(MemoryResourceTest, TrimLargestFirst) {
+    void* small_ptr = mr->allocate(100);
+    void* large_ptr = mr->allocate(1000);
+    mr->deallocate(small_ptr, 100);
+    mr->deallocate(large_ptr, 1000);
+
+    EXPECT_EQ(mr->trim(500), 1000);
+    EXPECT_EQ(mr->bytes_cached(), 100);
+    EXPECT_EQ(mr->trim(), 100);
+    EXPECT_EQ(mr->footprint(), 0);
+}
+
+TEST_F(MemoryResourceTest, TrimOrderPerCallKeepsAgeOrder) {
+    void* oldest = mr->allocate(300);
+    void* large = mr->allocate(1000);
+    void* newest = mr->allocate(200);
+    mr->deallocate(oldest, 300);
+    mr->deallocate(large, 1000);
+    mr->deallocate(newest, 200);
+
+    // Сначала крупный блок, затем самый старый из оставшихся
+    EXPECT_EQ(mr->trim(600, dynamic_memory_resource::trim_order::largest_first), 1000);
+    EXPECT_EQ(mr->trim(250, dynamic_memory_resource::trim_order::oldest_first), 300);
+    EXPECT_EQ(mr->bytes_cached(), 200);
+
+    void* reused = mr->allocate(150);
+    EXPECT_EQ(reused, newest);
+    mr->deallocate(reused, 150);
+}
+
+TEST_F(MemoryResourceTest, MaxCachedBytesOldestFirst) {
+    mr->set_max_cached_bytes(150, dynamic_memory_resource::trim_order::oldest_first);
+
+    void* first = mr->allocate(100);
+    void* second = mr->allocate(100);
+    mr->deallocate(first, 100);
+    EXPECT_EQ(mr->bytes_cached(), 100);
+
+    // Кэш переполнен: возвращается самый старый блок
+    mr->deallocate(second, 100);
+    EXPECT_EQ(mr->bytes_cached(), 100);
+
+    void* reused = mr->allocate(100);
+    EXPECT_EQ(reused, second);
+    mr->deallocate(reused, 100);
+}
+
+TEST_F(MemoryResourceTest, BudgetTrimsCacheBeforeFailing) {
+    mr->set_budget(1000);
+
+    void* ptr = mr->allocate(800);
+    mr->deallocate(ptr, 800);
+
+    // Закэшированный блок слишком мал, но его можно вернуть upstream
+    void* bigger = mr->allocate(900);
+    EXPECT_NE(bigger, nullptr);
+    EXPECT_EQ(mr->bytes_cached(), 0);
+    EXPECT_EQ(mr->footprint(), 900);
+
+    EXPECT_THROW(static_cast<void>(mr->allocate(200)), std::bad_alloc);
+    mr->deallocate(bigger, 900);
+}
+
+TEST_F(MemoryResourceTest, BudgetHandler) {
+    std::size_t reported = 0;
+    bool allow = false;
+    mr->set_budget(100, [&](std::size_t requested, std::size_t) {
+        reported = requested;
+        return allow;
+    });
+
+    EXPECT_THROW(static_cast<void>(mr->allocate(200)), std::bad_alloc);
+    EXPECT_EQ(reported, 200);
+
+    allow = true;
+    void* ptr = mr->allocate(200);
+    EXPECT_NE(ptr, nullptr);
+    mr->deallocate(ptr, 200);
+}
+
+TEST_F(MemoryResourceTest, ProfilingOffByDefault) {
+    EXPECT_EQ(mr->profiler(), nullptr);
+    EXPECT_EQ(mr->stop_profiling(), nullptr);
+}
+
+TEST_F(MemoryResourceTest, ProfilerAggregatesLiveBytesByTag) {
+    mr->start_profiling(1);
+
+    void* a;
+    void* b;
+    {
+        allocation_tag outer("loader");
+        a = mr->allocate(100);
+        {
+            allocation_tag inner("parse");
+            b = mr->allocate(50);
+        }
+    }
+
+    ASSERT_NE(mr->profiler(), nullptr);
+    EXPECT_EQ(mr->profiler()->live_bytes("loader"), 100);
+    EXPECT_EQ(mr->profiler()->live_bytes("loader;parse"), 50);
+
+    mr->deallocate(a, 100);
+    EXPECT_EQ(mr->profiler()->live_bytes("loader"), 0);
+
+    std::ostringstream folded;
+    mr->profiler()->write_folded(folded);
+    EXPECT_EQ(folded.str(), "loader;parse 50\n");
+
+    mr->deallocate(b, 50);
+    auto profile = mr->stop_profiling();
+    ASSERT_NE(profile, nullptr);
+    EXPECT_EQ(profile->total_live_bytes(), 0);
+    EXPECT_EQ(mr->profiler(), nullptr);
+}
+
+TEST_F(MemoryResourceTest, ProfilerSamplesEveryNthByte) {
+    mr->start_profiling(1024);
+    allocation_tag tag(typeid(dynamic_array<int>).name());
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 64; ++i) {
+        blocks.push_back(mr->allocate(256));
+    }
+
+    // 64 * 256 байт = 16 сэмплов по 1024 байта
+    EXPECT_EQ(mr->profiler()->total_live_bytes(), 64 * 256);
+
+    for (void* block : blocks) {
+        mr->deallocate(block, 256);
+    }
+    EXPECT_EQ(mr->profiler()->total_live_bytes(), 0);
+}
+
+TEST_F(MemoryResourceTest, ProfilerRecordsStackWithoutTag) {
+    mr->start_profiling(1);
+    void* ptr = mr->allocate(64);
+
+    std::ostringstream folded;
+    mr->profiler()->write_folded(folded);
+    EXPECT_NE(folded.str().find(" 64"), std::string::npos);
+#if defined(__GLIBC__)
+    // Символы экспортируются (ENABLE_EXPORTS), поэтому в стеке есть имя теста
+    EXPECT_NE(folded.str().find("ProfilerRecordsStackWithoutTag"), std::string::npos) << folded.str();
+    // Кадры профилировщика и ресурса отрезаны при любом встраивании
+    EXPECT_EQ(folded.str().find("allocation_profiler::"), std::string::npos) << folded.str();
+    EXPECT_EQ(folded.str().find("dynamic_memory_resource::"), std::string::npos) << folded.str();
+#endif
+
+    mr->deallocate(ptr, 64);
+}
+
+TEST(UpstreamResourceTest, BlocksComeFromUpstream) {
+    std::pmr::monotonic_buffer_resource upstream;
+    dynamic_memory_resource mr(&upstream);
+    EXPECT_EQ(mr.upstream_resource(), &upstream);
+
+    dynamic_array<int> arr(&mr);
+    for (int i = 0; i < 100; ++i) {
+        arr.push_back(i);
+    }
+    EXPECT_EQ(arr[99], 99);
+}
+
+TEST(UpstreamResourceTest, ReuseRespectsAlignment) {
+    dynamic_memory_resource mr;
+    void* ptr = mr.allocate(256, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64, 0u);
+    mr.deallocate(ptr, 256, 64);
+
+    void* reused = mr.allocate(128, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(reused) % 64, 0u);
+    mr.deallocate(reused, 128, 64);
+}
+
+TEST(HugePageResourceTest, SubdividesRegion) {
+    huge_page_resource upstream;
+    void* a = upstream.allocate(1000, 16);
+    void* b = upstream.allocate(1000, 64);
+
+    EXPECT_NE(a, b);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 64, 0u);
+    EXPECT_EQ(upstream.reserved_bytes(), std::size_t(64) << 20);
+}
+
+TEST(HugePageResourceTest, LargeRequestGetsOwnRegion) {
+    huge_page_resource upstream(huge_page_resource::huge_page_size);
+    void* big = upstream.allocate(5 * huge_page_resource::huge_page_size);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % huge_page_resource::huge_page_size, 0u);
+    EXPECT_GE(upstream.reserved_bytes(), 5 * huge_page_resource::huge_page_size);
+}
+
+TEST(HugePageResourceTest, TrimReturnsLargeBlocksToSystem) {
+    huge_page_resource upstream;
+    dynamic_memory_resource mr(&upstream);
+
+    for (int round = 0; round < 5; ++round) {
+        void* p = mr.allocate(std::size_t(40) << 20);
+        mr.deallocate(p, std::size_t(40) << 20);
+        mr.trim();
+        EXPECT_EQ(mr.footprint(), 0);
+        EXPECT_EQ(upstream.reserved_bytes(), 0);
+    }
+}
+
+TEST(HugePageResourceTest, ReleasesFullyFreedRegions) {
+    huge_page_resource upstream(huge_page_resource::huge_page_size);
+    const std::size_t block = std::size_t(1) << 20;
+
+    // Два блока по 1 МБ заполняют первый регион, третий открывает второй
+    void* a = upstream.allocate(block);
+    void* b = upstream.allocate(block);
+    void* c = upstream.allocate(block);
+    EXPECT_EQ(upstream.reserved_bytes(), 2 * huge_page_resource::huge_page_size);
+
+    upstream.deallocate(a, block);
+    EXPECT_EQ(upstream.reserved_bytes(), 2 * huge_page_resource::huge_page_size);
+    upstream.deallocate(b, block);
+    EXPECT_EQ(upstream.reserved_bytes(), huge_page_resource::huge_page_size);
+
+    // Текущий регион после освобождения нарезается заново
+    upstream.deallocate(c, block);
+    void* d = upstream.allocate(block);
+    EXPECT_EQ(d, c);
+    EXPECT_EQ(upstream.reserved_bytes(), huge_page_resource::huge_page_size);
+    upstream.deallocate(d, block);
+}
+
+TEST(HugePageResourceTest, HonoursAlignmentAboveHugePage) {
+    huge_page_resource upstream;
+    const std::size_t alignment = std::size_t(4) << 20;
+
+    for (int i = 0; i < 4; ++i) {
+        void* p = upstream.allocate(100, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignment, 0u);
+        EXPECT_EQ(upstream.reserved_bytes(), huge_page_resource::huge_page_size);
+        upstream.deallocate(p, 100, alignment);
+        EXPECT_EQ(upstream.reserved_bytes(), 0);
+    }
+}
+
+TEST(HugePageResourceTest, BacksDynamicArray) {
+    huge_page_resource upstream;
+    dynamic_memory_resource mr(&upstream);
+    dynamic_array<double> arr(&mr);
+
+    for (int i = 0; i < 10000; ++i) {
+        arr.push_back(i * 1.5);
+    }
+    EXPECT_EQ(arr.size(), 10000);
+    EXPECT_EQ(arr[9999], 9999 * 1.5);
+}
+
+// Тесты для guarded_memory_resource
+class GuardedResourceTest : public ::testing::Test {
+protected:
+    struct violation_error {
+        guarded_memory_resource::guard_violation violation;
+    };
+
+    void SetUp() override {
+        mr = std::make_unique<guarded_memory_resource>();
+        mr->set_violation_handler([](guarded_memory_resource::guard_violation v, void*) {
+            throw violation_error{v};
+        });
+    }
+
+    guarded_memory_resource::guard_violation violation_of(std::function<void()> action) {
+        try {
+            action();
+        } catch (const violation_error& e) {
+            return e.violation;
+        }
+        ADD_FAILURE() << "no violation reported";
+        return guarded_memory_resource::guard_violation::foreign_pointer;
+    }
+
+    std::unique_ptr<guarded_memory_resource> mr;
+};
+
+TEST_F(GuardedResourceTest, CleanUsage) {
+    dynamic_array<std::string> arr(mr.get());
+    for (int i = 0; i < 100; ++i) {
+        arr.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(arr[99], "99");
+    EXPECT_GT(mr->quarantined_bytes(), 0);
+
+    mr->flush_quarantine();
+    EXPECT_EQ(mr->quarantined_bytes(), 0);
+    EXPECT_EQ(mr->live_blocks(), 1);
+}
+
+TEST_F(GuardedResourceTest, PoisonFillOnFree) {
+    auto* bytes = static_cast<unsigned char*>(mr->allocate(32));
+    std::memset(bytes, 0, 32);
+    mr->deallocate(bytes, 32);
+
+    // Блок в карантине, память еще принадлежит ресурсу
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(bytes[i], guarded_memory_resource::poison);
+    }
+}
+
+TEST_F(GuardedResourceTest, DetectsDoubleFree) {
+    void* ptr = mr->allocate(64);
+    mr->deallocate(ptr, 64);
+    EXPECT_EQ(violation_of([&] { mr->deallocate(ptr, 64); }),
+              guarded_memory_resource::guard_violation::double_free);
+}
+
+TEST_F(GuardedResourceTest, DetectsForeignPointer) {
+    int local = 0;
+    EXPECT_EQ(violation_of([&] { mr->deallocate(&local, sizeof(local)); }),
+              guarded_memory_resource::guard_violation::foreign_pointer);
+}
+
+TEST_F(GuardedResourceTest, DetectsBufferOverflow) {
+    auto* bytes = static_cast<char*>(mr->allocate(16));
+    bytes[16] = 'x';
+    EXPECT_EQ(violation_of([&] { mr->deallocate(bytes, 16); }),
+              guarded_memory_resource::guard_violation::buffer_overflow);
+}
+
+TEST_F(GuardedResourceTest, DetectsUseAfterFree) {
+    auto* value = static_cast<int*>(mr->allocate(sizeof(int)));
+    mr->deallocate(value, sizeof(int));
+    *value = 42;
+    EXPECT_EQ(violation_of([&] { mr->flush_quarantine(); }),
+              guarded_memory_resource::guard_violation::use_after_free);
+}
+
+TEST(GuardedResourceAccountingTest, CorruptHeaderInQuarantineIsStillReleased) {
+    dynamic_memory_resource upstream;
+    guarded_memory_resource guarded(&upstream, 4096);
+    std::size_t violations = 0;
+    guarded.set_violation_handler([&](guarded_memory_resource::guard_violation, void*) {
+        ++violations;
+    });
+
+    for (int round = 0; round < 3; ++round) {
+        char* block = static_cast<char*>(guarded.allocate(64));
+        guarded.deallocate(block, 64);
+        // Запись перед блоком портит переднюю канарейку заголовка
+        block[-1] = 0;
+        guarded.flush_quarantine();
+        EXPECT_EQ(guarded.quarantined_bytes(), 0);
+    }
+    EXPECT_EQ(violations, 3);
+    EXPECT_EQ(upstream.bytes_in_use(), 0);
+}
+
+TEST(GuardedResourceAccountingTest, UnderflowThenDestructionDoesNotCrash) {
+    dynamic_memory_resource upstream;
+    std::size_t violations = 0;
+    {
+        guarded_memory_resource guarded(&upstream, 4096);
+        guarded.set_violation_handler([&](guarded_memory_resource::guard_violation, void*) {
+            ++violations;
+        });
+
+        char* a = static_cast<char*>(guarded.allocate(64));
+        char* b = static_cast<char*>(guarded.allocate(64));
+        // Выход за начало b целиком затирает его заголовок
+        for (int i = 1; i <= 32; ++i) {
+            b[-i] = 0x41;
+        }
+        guarded.deallocate(b, 64);
+        EXPECT_EQ(guarded.live_blocks(), 1);
+        (void)a;
+    }
+    EXPECT_EQ(violations, 1);
+    EXPECT_EQ(upstream.bytes_in_use(), 0);
+}
+
+TEST_F(GuardedResourceTest, QuarantineIsBounded) {
+    guarded_memory_resource small(std::pmr::new_delete_resource(), 4096);
+    for (int i = 0; i < 100; ++i) {
+        small.deallocate(small.allocate(1000), 1000);
+        EXPECT_LE(small.quarantined_bytes(), 4096);
+    }
+}
+
+// Тесты для scratch_arena
+TEST(ScratchArenaTest, CheckpointRewinds) {
+    scratch_arena arena(1024);
+    {
+        scratch_arena::checkpoint scope(arena);
+        dynamic_array<int> temp(&arena);
+        for (int i = 0; i < 100; ++i) {
+            temp.push_back(i);
+        }
+        EXPECT_EQ(temp[99], 99);
+        EXPECT_GT(arena.bytes_used(), 0);
+    }
+    EXPECT_EQ(arena.bytes_used(), 0);
+}
+
+TEST(ScratchArenaTest, ChunksAreReusedAcrossIterations) {
+    std::pmr::monotonic_buffer_resource upstream;
+    scratch_arena arena(256, &upstream);
+
+    std::size_t reserved = 0;
+    for (int iteration = 0; iteration < 10; ++iteration) {
+        scratch_arena::checkpoint scope(arena);
+        dynamic_array<double> temp(&arena);
+        for (int i = 0; i < 200; ++i) {
+            temp.push_back(i);
+        }
+        if (iteration == 0) {
+            reserved = arena.reserved_bytes();
+        }
+        // После первой итерации новых чанков не требуется
+        EXPECT_EQ(arena.reserved_bytes(), reserved);
+    }
+}
+
+TEST(ScratchArenaTest, NestedCheckpoints) {
+    scratch_arena arena;
+    scratch_arena::checkpoint outer(arena);
+
+    void* a = arena.allocate(100);
+    std::size_t after_outer = arena.bytes_used();
+    {
+        scratch_arena::checkpoint inner(arena);
+        (void)arena.allocate(1000);
+        EXPECT_GT(arena.bytes_used(), after_outer);
+    }
+    EXPECT_EQ(arena.bytes_used(), after_outer);
+
+    outer.rewind();
+    EXPECT_EQ(arena.allocate(100), a);
+}
+
+TEST(ScratchArenaTest, RespectsAlignment) {
+    scratch_arena arena;
+    scratch_arena::checkpoint scope(arena);
+    (void)arena.allocate(3, 1);
+    void* aligned = arena.allocate(64, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0u);
+}
+
+TEST(ScratchArenaTest, ThreadLocalInstances) {
+    scratch_arena* main_arena = &scratch_arena::local();
+    scratch_arena* other_arena = nullptr;
+    std::thread worker([&other_arena] { other_arena = &scratch_arena::local(); });
+    worker.join();
+
+    EXPECT_EQ(main_arena, &scratch_arena::local());
+    EXPECT_NE(main_arena, other_arena);
+}
+
+// Тесты для numa_memory_resource (на одном узле проверяется откат)
+TEST(NumaResourceTest, NodeCountIsPositive) {
+    EXPECT_GE(numa_node_count(), 1);
+}
+
+TEST(NumaResourceTest, AllocatesWithEveryPolicy) {
+    for (numa_policy policy : {numa_policy::first_touch, numa_policy::bind,
+                               numa_policy::interleave, numa_policy::partition}) {
+        numa_memory_resource upstream(policy, 0);
+        dynamic_memory_resource mr(&upstream);
+        dynamic_array<double> arr(&mr);
+        for (int i = 0; i < 100000; ++i) {
+            arr.push_back(i);
+        }
+        EXPECT_EQ(arr[99999], 99999.0);
+        if (numa_node_count() == 1) {
+            EXPECT_EQ(upstream.failed_placements(), 0);
+        }
+    }
+}
+
+TEST(NumaResourceTest, InvalidNodeFallsBackToZero) {
+    numa_memory_resource upstream(numa_policy::bind, 1000);
+    EXPECT_EQ(upstream.node(), 0);
+    EXPECT_EQ(upstream.policy(), numa_policy::bind);
+}
+
+TEST(NumaResourceTest, HonorsLargeAlignment) {
+    numa_memory_resource upstream(numa_policy::bind, 0);
+    const std::size_t alignment = std::size_t(2) << 20;
+    for (int i = 0; i < 4; ++i) {
+        void* p = upstream.allocate(4096, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignment, 0u);
+        static_cast<char*>(p)[4095] = 1;
+        upstream.deallocate(p, 4096, alignment);
+    }
+}
+
+TEST(NumaResourceTest, PlaceRejectsInvalidNode) {
+    dynamic_array<int> arr(1000);
+    EXPECT_FALSE(numa_place(arr, numa_policy::bind, -1));
+    EXPECT_FALSE(numa_place(arr, numa_policy::bind, 64));
+    EXPECT_FALSE(numa_place(arr, numa_policy::bind, numa_node_count()));
+}
+
+TEST(NumaResourceTest, PlaceExistingArray) {
+    dynamic_array<int> arr(100000);
+    bool interleaved = numa_place(arr, numa_policy::interleave);
+    bool partitioned = numa_place(arr, numa_policy::partition);
+    if (numa_node_count() == 1) {
+        // Без NUMA размещение - пустая операция
+        EXPECT_TRUE(interleaved);
+        EXPECT_TRUE(partitioned);
+    }
+    arr[0] = 1;
+    EXPECT_EQ(arr[0], 1);
+}
+
 // Тесты для dynamic_array с простыми типами
 TEST_F(DynamicArrayTest, DefaultConstructor) {
     EXPECT_EQ(arr_int->size(), 0);
@@ -238,6 +786,66 @@ TEST_F(DynamicArrayTest, InitialSizeConstructor) {
     EXPECT_GE(arr_with_size.capacity(), 5);
 }
 
+TEST_F(DynamicArrayTest, InitialSizeValueInitializes) {
+    dynamic_array<double> arr(1000, mr.get());
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        EXPECT_EQ(arr[i], 0.0);
+    }
+}
+
+TEST_F(DynamicArrayTest, DefaultInitConstructor) {
+    dynamic_array<double> arr(1000, default_init, mr.get());
+    EXPECT_EQ(arr.size(), 1000);
+    EXPECT_EQ(arr.capacity(), 1000);
+
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        arr[i] = i * 0.5;
+    }
+    EXPECT_EQ(arr[999], 499.5);
+
+    dynamic_array<std::string> strings(3, default_init, mr.get());
+    EXPECT_EQ(strings.size(), 3);
+    EXPECT_TRUE(strings[2].empty());
+}
+
+TEST_F(DynamicArrayTest, FillConstructor) {
+    dynamic_array<int> ints(100, 7, mr.get());
+    EXPECT_EQ(ints.size(), 100);
+    EXPECT_TRUE(std::all_of(ints.begin(), ints.end(), [](int v) { return v == 7; }));
+
+    dynamic_array<std::string> strings(3, std::string("abc"), mr.get());
+    EXPECT_EQ(strings[0], "abc");
+    EXPECT_EQ(strings[2], "abc");
+}
+
+TEST_F(DynamicArrayTest, FillWithLiteralZero) {
+    // Литерал 0 - заполнитель, а не нулевой memory_resource*
+    static_assert(std::is_constructible_v<dynamic_array<double>, std::size_t, int>);
+    dynamic_array<double> doubles(5, 0);
+    EXPECT_EQ(doubles.size(), 5);
+    EXPECT_EQ(doubles[4], 0.0);
+
+    dynamic_array<double> halves(4, 0.5f, mr.get());
+    EXPECT_EQ(halves[3], 0.5);
+
+    dynamic_array<std::string> strings(2, "abc", mr.get());
+    EXPECT_EQ(strings[1], "abc");
+}
+
+TEST_F(DynamicArrayTest, ResizeForOverwrite) {
+    arr_int->push_back(1);
+    arr_int->push_back(2);
+
+    arr_int->resize_for_overwrite(10);
+    EXPECT_EQ(arr_int->size(), 10);
+    EXPECT_EQ((*arr_int)[0], 1);
+    EXPECT_EQ((*arr_int)[1], 2);
+
+    arr_int->resize_for_overwrite(1);
+    EXPECT_EQ(arr_int->size(), 1);
+    EXPECT_EQ((*arr_int)[0], 1);
+}
+
 TEST_F(DynamicArrayTest, PushBackRvalue) {
     std::string str = "temporary";
     arr_string->push_back(std::move(str));
@@ -245,6 +853,98 @@ TEST_F(DynamicArrayTest, PushBackRvalue) {
     EXPECT_EQ((*arr_string)[0], "temporary");
 }
 
+TEST_F(DynamicArrayTest, PopBackAndClear) {
+    for (int i = 0; i < 5; ++i) {
+        arr_int->push_back(i);
+    }
+    std::size_t capacity = arr_int->capacity();
+
+    arr_int->pop_back();
+    EXPECT_EQ(arr_int->size(), 4);
+    EXPECT_EQ((*arr_int)[3], 3);
+
+    arr_int->clear();
+    EXPECT_TRUE(arr_int->empty());
+    EXPECT_EQ(arr_int->capacity(), capacity);
+
+    arr_string->pop_back();
+    EXPECT_TRUE(arr_string->empty());
+}
+
+TEST_F(DynamicArrayTest, EraseShiftsTail) {
+    for (int i = 0; i < 6; ++i) {
+        arr_int->push_back(i);
+    }
+
+    auto it = arr_int->erase(arr_int->begin());
+    EXPECT_EQ(*it, 1);
+
+    auto first = arr_int->begin();
+    ++first;
+    auto last = first;
+    ++last;
+    ++last;
+    it = arr_int->erase(first, last);
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(std::vector<int>(arr_int->begin(), arr_int->end()), std::vector<int>({1, 4, 5}));
+}
+
+TEST_F(DynamicArrayTest, InsertShiftsTail) {
+    arr_int->push_back(1);
+    arr_int->push_back(3);
+
+    auto pos = arr_int->begin();
+    ++pos;
+    auto it = arr_int->insert(pos, 2);
+    EXPECT_EQ(*it, 2);
+
+    arr_int->insert(arr_int->begin(), 0);
+    arr_int->insert(arr_int->end(), 4);
+    EXPECT_EQ(std::vector<int>(arr_int->begin(), arr_int->end()), std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+TEST_F(DynamicArrayTest, InsertEraseStrings) {
+    arr_string->push_back("a");
+    arr_string->push_back("c");
+    arr_string->insert(arr_string->begin(), (*arr_string)[1]);
+
+    auto pos = arr_string->begin();
+    ++pos;
+    ++pos;
+    arr_string->insert(pos, std::string("b"));
+    EXPECT_EQ(std::vector<std::string>(arr_string->begin(), arr_string->end()),
+              std::vector<std::string>({"c", "a", "b", "c"}));
+
+    arr_string->erase(arr_string->begin());
+    EXPECT_EQ(std::vector<std::string>(arr_string->begin(), arr_string->end()),
+              std::vector<std::string>({"a", "b", "c"}));
+}
+
+TEST_F(DynamicArrayTest, EraseIfCompactsInPlace) {
+    for (int i = 0; i < 20; ++i) {
+        arr_int->push_back(i);
+    }
+    std::size_t capacity = arr_int->capacity();
+
+    EXPECT_EQ(arr_int->erase_if([](int value) { return value % 3 != 0; }), 13);
+    EXPECT_EQ(std::vector<int>(arr_int->begin(), arr_int->end()),
+              std::vector<int>({0, 3, 6, 9, 12, 15, 18}));
+    EXPECT_EQ(arr_int->capacity(), capacity);
+}
+
+TEST(DynamicArrayComplexTest, EraseIfPerson) {
+    dynamic_memory_resource mr;
+    dynamic_array<Person> people(&mr);
+    people.push_back(Person("Alice", 25, 50000.0));
+    people.push_back(Person("Bob", 17, 0.0));
+    people.push_back(Person("Charlie", 35, 70000.0));
+
+    people.erase_if([](const Person& p) { return p.age < 18; });
+    ASSERT_EQ(people.size(), 2);
+    EXPECT_EQ(people[0].name, "Alice");
+    EXPECT_EQ(people[1].name, "Charlie");
+}
+
 // Тесты для итераторов
 TEST_F(DynamicArrayTest, IteratorBeginEnd) {
     EXPECT_EQ(arr_int->begin(), arr_int->end());
@@ -578,6 +1278,857 @@ TEST(PerformanceTest, MemoryEfficiency) {
     }
 }
 
+// Тесты для ленивых адаптеров
+class RangeViewsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        people.push_back(Person("Alice", 25, 50000.0));
+        people.push_back(Person("Bob", 35, 60000.0));
+        people.push_back(Person("Charlie", 45, 70000.0));
+        people.push_back(Person("Diana", 30, 80000.0));
+    }
+
+    dynamic_array<Person> people;
+};
+
+TEST_F(RangeViewsTest, FilterTransformReduceFused) {
+    int calls = 0;
+    double total = people
+        | views::filter([](const Person& p) { return p.age >= 30; })
+        | views::transform([&calls](const Person& p) { ++calls; return p.salary; })
+        | views::reduce(0.0, std::plus<>());
+
+    EXPECT_EQ(total, 60000.0 + 70000.0 + 80000.0);
+    EXPECT_EQ(calls, 3);
+}
+
+TEST_F(RangeViewsTest, ViewsAreLazy) {
+    int calls = 0;
+    auto names = people | views::transform([&calls](const Person& p) { ++calls; return p.name; });
+    EXPECT_EQ(calls, 0);
+
+    auto first_two = std::move(names) | views::take(2);
+    std::vector<std::string> result(first_two.begin(), first_two.end());
+    EXPECT_EQ(result, std::vector<std::string>({"Alice", "Bob"}));
+    EXPECT_EQ(calls, 2);
+}
+
+TEST_F(RangeViewsTest, ModifyThroughFilter) {
+    for (Person& p : people | views::filter([](const Person& p) { return p.age > 40; })) {
+        p.salary += 1000.0;
+    }
+    EXPECT_EQ(people[2].salary, 71000.0);
+    EXPECT_EQ(people[0].salary, 50000.0);
+}
+
+TEST_F(RangeViewsTest, Zip) {
+    dynamic_array<int> bonuses;
+    bonuses.push_back(10);
+    bonuses.push_back(20);
+    bonuses.push_back(30);
+
+    std::vector<std::string> result;
+    for (auto pair : views::zip(people, bonuses)) {
+        result.push_back(pair.first.name + std::to_string(pair.second));
+    }
+    EXPECT_EQ(result, std::vector<std::string>({"Alice10", "Bob20", "Charlie30"}));
+
+    int count = 0;
+    for (auto pair : people | views::zip(bonuses)) {
+        (void)pair;
+        ++count;
+    }
+    EXPECT_EQ(count, 3);
+}
+
+TEST_F(RangeViewsTest, ZipAdaptorIsReusable) {
+    // Адаптер владеет временным вектором; повторное применение не должно
+    // видеть его перемещенным
+    auto with_bonus = views::zip(std::vector<int>{10, 20, 30});
+
+    for (int round = 0; round < 2; ++round) {
+        int total = people | with_bonus | views::reduce(0, [](int sum, const auto& pair) {
+            return sum + pair.second;
+        });
+        EXPECT_EQ(total, 60);
+    }
+}
+
+TEST(RangeViewsChunkTest, Chunk) {
+    dynamic_array<int> arr;
+    for (int i = 1; i <= 7; ++i) {
+        arr.push_back(i);
+    }
+
+    std::vector<int> sums;
+    for (auto chunk : arr | views::chunk(3)) {
+        int sum = 0;
+        for (int value : chunk) {
+            sum += value;
+        }
+        sums.push_back(sum);
+    }
+    EXPECT_EQ(sums, std::vector<int>({6, 15, 7}));
+}
+
+TEST_F(RangeViewsTest, CollectIntoChosenResource) {
+    dynamic_memory_resource mr;
+    auto ages = people
+        | views::filter([](const Person& p) { return p.salary > 55000.0; })
+        | views::transform(&Person::age)
+        | views::collect(&mr);
+
+    ASSERT_EQ(ages.size(), 3);
+    EXPECT_EQ(ages[0], 35);
+    EXPECT_EQ(ages[2], 30);
+    // Емкость зарезервирована заранее по верхней оценке
+    EXPECT_EQ(ages.capacity(), people.size());
+    EXPECT_EQ(mr.bytes_in_use(), people.size() * sizeof(int));
+}
+
+TEST(DynamicArrayMoveTest, MoveConstructor) {
+    dynamic_memory_resource mr;
+    dynamic_array<std::string> source(&mr);
+    source.push_back("moved");
+
+    dynamic_array<std::string> target(std::move(source));
+    EXPECT_EQ(target.size(), 1);
+    EXPECT_EQ(target[0], "moved");
+    EXPECT_TRUE(source.empty());
+}
+
+// Тесты для static_dynamic_array
+constexpr int constexpr_sum_of_squares() {
+    static_dynamic_array<int, 8> arr;
+    for (int i = 1; i <= 4; ++i) {
+        arr.push_back(i * i);
+    }
+    int sum = 0;
+    for (int value : arr) {
+        sum += value;
+    }
+    return sum;
+}
+
+TEST(StaticArrayTest, ConstexprUsage) {
+    static_assert(constexpr_sum_of_squares() == 1 + 4 + 9 + 16);
+    static_assert(static_dynamic_array<double, 16>::capacity() == 16);
+    EXPECT_EQ(constexpr_sum_of_squares(), 30);
+}
+
+TEST(StaticArrayTest, SameInterfaceAsDynamicArray) {
+    static_dynamic_array<std::string, 4> arr;
+    EXPECT_TRUE(arr.empty());
+
+    arr.push_back("a");
+    std::string b = "b";
+    arr.push_back(std::move(b));
+    EXPECT_EQ(arr.size(), 2);
+    EXPECT_EQ(arr[1], "b");
+
+    std::vector<std::string> items(arr.cbegin(), arr.cend());
+    EXPECT_EQ(items, std::vector<std::string>({"a", "b"}));
+
+    arr.pop_back();
+    EXPECT_EQ(arr.size(), 1);
+    arr.clear();
+    EXPECT_TRUE(arr.empty());
+}
+
+TEST(StaticArrayTest, OverflowThrows) {
+    static_dynamic_array<Person, 2> people;
+    people.push_back(Person("Alice", 25, 50000.0));
+    people.push_back(Person("Bob", 30, 60000.0));
+    EXPECT_TRUE(people.full());
+    EXPECT_THROW(people.push_back(Person("Charlie", 35, 70000.0)), std::length_error);
+}
+
+TEST(StaticArrayTest, StorageIsInline) {
+    EXPECT_EQ(sizeof(static_dynamic_array<int, 16>), sizeof(int) * 16 + sizeof(std::size_t));
+}
+
+// Тесты для hash_index
+TEST(HashIndexTest, FindPersonByName) {
+    dynamic_memory_resource mr;
+    dynamic_array<Person> people(&mr);
+    people.push_back(Person("Alice", 25, 50000.0));
+    people.push_back(Person("Bob", 30, 60000.0));
+    people.push_back(Person("Charlie", 35, 70000.0));
+
+    hash_index index(people, &Person::name);
+    EXPECT_EQ(index.size(), 3);
+    ASSERT_NE(index.find("Bob"), nullptr);
+    EXPECT_EQ(index.find("Bob")->age, 30);
+    EXPECT_EQ(index.index_of("Charlie"), 2);
+    EXPECT_EQ(index.find("Eve"), nullptr);
+    EXPECT_FALSE(index.contains("Eve"));
+}
+
+TEST(HashIndexTest, IncrementalSync) {
+    dynamic_array<Person> people;
+    people.push_back(Person("Alice", 25, 50000.0));
+
+    hash_index index(people, &Person::name);
+    people.push_back(Person("Bob", 30, 60000.0));
+    EXPECT_FALSE(index.contains("Bob"));
+
+    index.sync();
+    EXPECT_TRUE(index.contains("Bob"));
+    EXPECT_EQ(index.size(), 2);
+}
+
+TEST(HashIndexTest, GrowsAndFindsManyKeys) {
+    dynamic_array<int> ids;
+    hash_index index(ids, [](int id) { return id; });
+
+    for (int i = 0; i < 5000; ++i) {
+        ids.push_back(i * 7);
+        if (i % 1000 == 999) index.sync();
+    }
+    index.sync();
+
+    EXPECT_EQ(index.size(), 5000);
+    EXPECT_LE(index.size() * 8, index.bucket_count() * 7);
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_EQ(index.index_of(i * 7), static_cast<std::size_t>(i));
+    }
+    EXPECT_EQ(index.index_of(3), decltype(index)::npos);
+}
+
+TEST(HashIndexTest, RebuildAfterErase) {
+    dynamic_array<std::string> names;
+    for (const char* name : {"a", "b", "c", "d"}) {
+        names.push_back(name);
+    }
+    hash_index index(names, [](const std::string& s) { return s; });
+
+    names.erase(names.begin());
+    index.rebuild();
+    EXPECT_EQ(index.index_of("d"), 2);
+    EXPECT_FALSE(index.contains("a"));
+}
+
+TEST(HashIndexTest, SyncAfterShrinkDropsStalePositions) {
+    dynamic_array<std::string> names;
+    for (const char* name : {"a", "b", "c", "d"}) {
+        names.push_back(name);
+    }
+    hash_index index(names, [](const std::string& s) { return s; });
+
+    names.pop_back();
+    index.sync();
+    EXPECT_FALSE(index.contains("d"));
+    EXPECT_EQ(index.index_of("c"), 2);
+
+    names.clear();
+    index.sync();
+    EXPECT_FALSE(index.contains("a"));
+
+    names.push_back("e");
+    index.sync();
+    EXPECT_EQ(index.index_of("e"), 0);
+}
+
+TEST(HashIndexTest, TablesFromArrayResource) {
+    dynamic_memory_resource mr;
+    dynamic_array<Person> people(&mr);
+    people.push_back(Person("Alice", 25, 50000.0));
+    std::size_t before = mr.bytes_in_use();
+
+    {
+        hash_index index(people, &Person::name);
+        EXPECT_GT(mr.bytes_in_use(), before);
+    }
+    EXPECT_EQ(mr.bytes_in_use(), before);
+}
+
+// Тесты для compressed_int_array
+TEST(CompressedIntArrayTest, RoundTripMixedBlocks) {
+    dynamic_array<int> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i * 3);                    // неубывающие: разности
+    }
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back((i * 7919) % 1000 - 500);  // случайные: от минимума
+    }
+    values.push_back(std::numeric_limits<int>::max());
+    values.push_back(std::numeric_limits<int>::min());
+
+    compressed_int_array packed(values);
+    EXPECT_EQ(packed.size(), values.size());
+    EXPECT_EQ(packed.block_count(), (values.size() + 127) / 128);
+
+    std::size_t i = 0;
+    for (int value : packed) {
+        ASSERT_EQ(value, values[i]) << "index " << i;
+        ++i;
+    }
+    EXPECT_EQ(i, values.size());
+    EXPECT_EQ(packed[1500], values[1500]);
+}
+
+TEST(CompressedIntArrayTest, SortedDataCompressesWell) {
+    dynamic_array<int> values;
+    for (int i = 0; i < 128 * 100; ++i) {
+        values.push_back(1000000 + i * 2);
+    }
+
+    compressed_int_array packed(values);
+    // Разность 2 укладывается в 2 бита на значение
+    EXPECT_LT(packed.memory_bytes() * 8, values.size() * sizeof(int));
+    EXPECT_EQ(packed[0], 1000000);
+    EXPECT_EQ(packed[values.size() - 1], 1000000 + static_cast<int>(values.size() - 1) * 2);
+}
+
+TEST(CompressedIntArrayTest, ConstantAndEmpty) {
+    dynamic_array<int> empty;
+    compressed_int_array none(empty);
+    EXPECT_TRUE(none.empty());
+    EXPECT_TRUE(none.begin() == none.end());
+
+    dynamic_array<int> same(300, 42);
+    compressed_int_array packed(same);
+    // Блоки из одинаковых значений не занимают слов данных
+    EXPECT_LE(packed.memory_bytes(), packed.block_count() * 16);
+    EXPECT_EQ(packed[299], 42);
+}
+
+TEST(CompressedIntArrayTest, DecompressAppends) {
+    dynamic_array<int> values;
+    for (int i = 0; i < 777; ++i) {
+        values.push_back(i % 2 ? -i : i);
+    }
+    compressed_int_array packed(values);
+
+    dynamic_array<int> out;
+    out.push_back(-1);
+    packed.decompress(out);
+    ASSERT_EQ(out.size(), values.size() + 1);
+    EXPECT_EQ(out[0], -1);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(out[i + 1], values[i]);
+    }
+}
+
+TEST(CompressedIntArrayTest, StorageFromResource) {
+    dynamic_memory_resource mr;
+    dynamic_array<int> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i * i);
+    }
+
+    {
+        compressed_int_array packed(values, &mr);
+        EXPECT_GT(mr.bytes_in_use(), 0);
+    }
+    EXPECT_EQ(mr.bytes_in_use(), 0);
+}
+
+// Тесты для chunked_loader
+static std::string loader_test_path(const std::string& name) {
+    return ::testing::TempDir() + name;
+}
+
+TEST(ChunkedLoaderTest, RoundTripAcrossSmallChunks) {
+    dynamic_array<TestStruct> items;
+    for (int i = 0; i < 500; ++i) {
+        items.push_back(TestStruct(i, i * 0.1, "name " + std::to_string(i)));
+    }
+    items.push_back(TestStruct(-7, 1e-300, ""));
+    std::string path = loader_test_path("loader_roundtrip.txt");
+    save_test_structs(path, items);
+
+    load_options options;
+    options.chunk_bytes = 37;  // чанки режут строки посередине
+    options.readahead = 3;
+
+    dynamic_array<TestStruct> loaded;
+    EXPECT_EQ(load_test_structs(path, loaded, options), items.size());
+    ASSERT_EQ(loaded.size(), items.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        ASSERT_EQ(loaded[i], items[i]) << "index " << i;
+    }
+    std::remove(path.c_str());
+}
+
+TEST(ChunkedLoaderTest, SerialMatchesPipelined) {
+    dynamic_array<TestStruct> items;
+    for (int i = 0; i < 2000; ++i) {
+        items.push_back(TestStruct(i, -i * 2.5, "x"));
+    }
+    std::string path = loader_test_path("loader_serial.txt");
+    save_test_structs(path, items);
+
+    load_options options;
+    options.chunk_bytes = 1024;
+
+    dynamic_memory_resource mr;
+    dynamic_array<TestStruct> serial(&mr);
+    dynamic_array<TestStruct> pipelined(&mr);
+    serial.push_back(TestStruct(1, 1.0, "existing"));
+    load_test_structs_serial(path, serial, options);
+    load_test_structs(path, pipelined, options);
+
+    ASSERT_EQ(serial.size(), items.size() + 1);
+    ASSERT_EQ(pipelined.size(), items.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        ASSERT_EQ(serial[i + 1], pipelined[i]);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(ChunkedLoaderTest, SkipsBlankLinesAndCarriageReturns) {
+    std::string path = loader_test_path("loader_crlf.txt");
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "1 2.5 Alice Smith\r\n\n2 3 Bob\n3 4";
+    }
+
+    dynamic_array<TestStruct> loaded;
+    EXPECT_EQ(load_test_structs(path, loaded), 3);
+    EXPECT_EQ(loaded[0], TestStruct(1, 2.5, "Alice Smith"));
+    EXPECT_EQ(loaded[1], TestStruct(2, 3.0, "Bob"));
+    EXPECT_EQ(loaded[2], TestStruct(3, 4.0, ""));
+    std::remove(path.c_str());
+}
+
+TEST(ChunkedLoaderTest, ReportsErrors) {
+    dynamic_array<TestStruct> loaded;
+    EXPECT_THROW(load_test_structs(loader_test_path("missing/none.txt"), loaded), std::runtime_error);
+
+    std::string path = loader_test_path("loader_bad.txt");
+    {
+        std::ofstream file(path);
+        file << "1 2.0 ok\nbroken line\n";
+    }
+    EXPECT_THROW(load_test_structs(path, loaded), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+// Тесты для cow_dynamic_array
+TEST(CowArrayTest, SnapshotIsStable) {
+    cow_dynamic_array<int> arr;
+    for (int i = 0; i < 200; ++i) {
+        arr.push_back(i);
+    }
+
+    auto snap = arr.take_snapshot();
+    arr.modify(5) = -5;
+    arr.push_back(200);
+    arr.pop_back();
+    arr.pop_back();
+
+    EXPECT_EQ(snap.size(), 200);
+    EXPECT_EQ(snap[5], 5);
+    EXPECT_EQ(snap[199], 199);
+    EXPECT_EQ(arr.size(), 199);
+    EXPECT_EQ(arr[5], -5);
+}
+
+TEST(CowArrayTest, UntouchedChunksAreShared) {
+    cow_dynamic_array<Person> people;
+    for (int i = 0; i < 256; ++i) {
+        people.push_back(Person("P" + std::to_string(i), i, 1000.0 * i));
+    }
+
+    auto snap = people.take_snapshot();
+    EXPECT_EQ(&snap[0], &people[0]);
+
+    people.modify(10).age = 99;
+    // Скопирован только чанк с элементом 10
+    EXPECT_NE(&snap[10], &people[10]);
+    EXPECT_EQ(&snap[200], &people[200]);
+    EXPECT_EQ(snap[10].age, 10);
+    EXPECT_EQ(people[10].age, 99);
+}
+
+TEST(CowArrayTest, NoCopyWithoutSnapshots) {
+    cow_dynamic_array<std::string> arr;
+    arr.push_back("a");
+    const std::string* before = &arr[0];
+
+    arr.modify(0) = "b";
+    EXPECT_EQ(&arr[0], before);
+
+    {
+        auto snap = arr.take_snapshot();
+    }
+    // Снимок освобожден: чанк снова принадлежит только массиву
+    arr.modify(0) = "c";
+    EXPECT_EQ(&arr[0], before);
+}
+
+TEST(CowArrayTest, SnapshotIteration) {
+    cow_dynamic_array<TestStruct> arr;
+    for (int i = 0; i < 100; ++i) {
+        arr.push_back(TestStruct(i, i * 1.5, "t"));
+    }
+    auto snap = arr.take_snapshot();
+
+    int expected = 0;
+    for (const auto& item : snap) {
+        EXPECT_EQ(item.id, expected++);
+    }
+    EXPECT_EQ(expected, 100);
+
+    cow_dynamic_array<TestStruct>::snapshot empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(CowArrayTest, ReadersSeeConsistentVersions) {
+    cow_dynamic_array<int> arr;
+    for (int i = 0; i < 1000; ++i) {
+        arr.push_back(0);
+    }
+
+    // Писатель увеличивает все элементы версии разом; любой снимок
+    // должен содержать одинаковые значения
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistent{0};
+    std::mutex published_mutex;
+    cow_dynamic_array<int>::snapshot published = arr.take_snapshot();
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                cow_dynamic_array<int>::snapshot snap;
+                {
+                    std::lock_guard<std::mutex> lock(published_mutex);
+                    snap = published;
+                }
+                for (int value : snap) {
+                    if (value != snap[0]) ++inconsistent;
+                }
+            }
+        });
+    }
+
+    for (int version = 1; version <= 50; ++version) {
+        for (std::size_t i = 0; i < arr.size(); ++i) {
+            arr.modify(i) = version;
+        }
+        auto snap = arr.take_snapshot();
+        std::lock_guard<std::mutex> lock(published_mutex);
+        published = snap;
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(published[999], 50);
+}
+
+// Тесты для concurrent_dynamic_array
+TEST(ConcurrentArrayTest, SingleThreadPushBack) {
+    dynamic_memory_resource mr;
+    concurrent_dynamic_array<int> arr(&mr);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(arr.push_back(i), static_cast<std::size_t>(i));
+    }
+
+    EXPECT_EQ(arr.size(), 100);
+    EXPECT_GE(arr.capacity(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(arr[i], i);
+    }
+}
+
+TEST(ConcurrentArrayTest, ReferencesStableDuringGrowth) {
+    concurrent_dynamic_array<std::string> arr;
+    arr.push_back("first");
+    const std::string* first = &arr[0];
+
+    for (int i = 0; i < 1000; ++i) {
+        arr.push_back(std::to_string(i));
+    }
+
+    EXPECT_EQ(first, &arr[0]);
+    EXPECT_EQ(*first, "first");
+}
+
+TEST(ConcurrentArrayTest, MultiProducerStress) {
+    concurrent_dynamic_array<int> arr;
+    const int threads = 8;
+    const int per_thread = 20000;
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&arr, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                std::size_t index = arr.push_back(t * per_thread + i);
+                // Свой элемент виден сразу после записи
+                EXPECT_EQ(arr[index], t * per_thread + i);
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    ASSERT_EQ(arr.size(), static_cast<std::size_t>(threads * per_thread));
+
+    // Каждое значение записано ровно один раз
+    std::vector<int> seen(threads * per_thread, 0);
+    for (int value : arr) {
+        ASSERT_GE(value, 0);
+        ASSERT_LT(value, threads * per_thread);
+        ++seen[value];
+    }
+    EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](int c) { return c == 1; }));
+}
+
+TEST(ConcurrentArrayTest, ReservePreallocatesSegments) {
+    concurrent_dynamic_array<double> arr;
+    arr.reserve(500);
+    std::size_t reserved = arr.capacity();
+    EXPECT_GE(reserved, 500);
+
+    for (int i = 0; i < 500; ++i) {
+        arr.push_back(i * 0.5);
+    }
+    EXPECT_EQ(arr.capacity(), reserved);
+    EXPECT_EQ(arr[499], 249.5);
+}
+
+// Ресурс, который отказывает в выделении, пока fail == true
+class failing_resource : public std::pmr::memory_resource {
+public:
+    std::atomic<bool> fail{false};
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        if (fail.load()) throw std::bad_alloc();
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TEST(ConcurrentArrayTest, FailedPushBackLeavesNoUnconstructedSlots) {
+    failing_resource mr;
+    {
+        concurrent_dynamic_array<std::string> arr(&mr);
+        for (int i = 0; i < 8; ++i) {
+            arr.push_back(std::to_string(i));
+        }
+
+        // Первый сегмент заполнен, второй выделить не удается
+        mr.fail = true;
+        EXPECT_THROW(arr.push_back("lost"), std::bad_alloc);
+        EXPECT_EQ(arr.size(), 9);
+        EXPECT_FALSE(arr.published(8));
+
+        mr.fail = false;
+        EXPECT_EQ(arr.push_back("after"), 9);
+        EXPECT_EQ(arr.size(), 10);
+        EXPECT_TRUE(arr.published(9));
+
+        std::vector<std::string> values(arr.begin(), arr.end());
+        ASSERT_EQ(values.size(), 9);
+        EXPECT_EQ(values.back(), "after");
+    }  // деструктор не трогает слот со сбоем
+}
+
+TEST(ConcurrentArrayTest, ReadersSeeOnlyPublishedElements) {
+    concurrent_dynamic_array<std::string> arr;
+    const int threads = 4;
+    const int per_thread = 5000;
+    std::atomic<bool> done{false};
+
+    std::thread reader([&] {
+        while (!done.load()) {
+            std::size_t size = arr.size();
+            for (std::size_t i = 0; i < size; ++i) {
+                // Все слоты ниже водяного знака построены
+                ASSERT_TRUE(arr.published(i));
+                ASSERT_FALSE(arr[i].empty());
+            }
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&arr] {
+            for (int i = 0; i < per_thread; ++i) {
+                arr.push_back(std::string(20, 'x'));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(arr.size(), static_cast<std::size_t>(threads * per_thread));
+}
+
+// Тесты сортировки и поиска
+TEST(SortTest, RadixSortInts) {
+    dynamic_memory_resource mr;
+    dynamic_array<int> arr(&mr);
+    std::vector<int> expected = {5, -3, 1000000, 0, -2147483647 - 1, 42, 2147483647, -3, 7};
+
+    for (int value : expected) {
+        arr.push_back(value);
+    }
+    arr.sort();
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int> actual(arr.begin(), arr.end());
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(SortTest, RadixSortDoubles) {
+    dynamic_memory_resource mr;
+    dynamic_array<double> arr(&mr);
+    std::vector<double> expected = {3.5, -1.25, 0.0, -1000.0, 1e-9, 2.0, -0.5, 1e300};
+
+    for (double value : expected) {
+        arr.push_back(value);
+    }
+    arr.sort();
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<double> actual(arr.begin(), arr.end());
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(SortTest, LargeRandomInts) {
+    dynamic_array<int> arr;
+    std::vector<int> expected;
+    unsigned state = 12345;
+    for (int i = 0; i < 10000; ++i) {
+        state = state * 1103515245u + 12345u;
+        int value = static_cast<int>(state);
+        arr.push_back(value);
+        expected.push_back(value);
+    }
+
+    arr.sort();
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(std::vector<int>(arr.begin(), arr.end()), expected);
+}
+
+TEST(SortTest, CustomComparator) {
+    dynamic_array<int> arr;
+    for (int value : {3, 1, 4, 1, 5}) {
+        arr.push_back(value);
+    }
+    arr.sort(std::greater<>());
+
+    EXPECT_EQ(std::vector<int>(arr.begin(), arr.end()), std::vector<int>({5, 4, 3, 1, 1}));
+}
+
+TEST(SortTest, SortPersonByKeyIsStable) {
+    dynamic_memory_resource mr;
+    dynamic_array<Person> people(&mr);
+    people.push_back(Person("Alice", 30, 50000.0));
+    people.push_back(Person("Bob", 25, 70000.0));
+    people.push_back(Person("Charlie", 30, 40000.0));
+    people.push_back(Person("Diana", 20, 60000.0));
+
+    people.sort_by_key(&Person::age);
+    EXPECT_EQ(people[0].name, "Diana");
+    EXPECT_EQ(people[1].name, "Bob");
+    EXPECT_EQ(people[2].name, "Alice");
+    EXPECT_EQ(people[3].name, "Charlie");
+
+    people.sort_by_key([](const Person& p) { return p.salary; });
+    EXPECT_EQ(people[0].name, "Charlie");
+    EXPECT_EQ(people[3].name, "Bob");
+
+    people.sort_by_key(&Person::name);
+    EXPECT_EQ(people[0].name, "Alice");
+    EXPECT_EQ(people[3].name, "Diana");
+}
+
+TEST(SortTest, SortByStringKeyUsesArrayResource) {
+    // Считает выделения, чтобы убедиться, что буферы сортировки
+    // берутся из ресурса массива
+    class counting_resource : public std::pmr::memory_resource {
+    public:
+        std::size_t allocations = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    counting_resource mr;
+    dynamic_array<Person> people(&mr);
+    const char* names[] = {"Eve", "Bob", "Alice", "Bob", "Dan", "Alice", "Carl"};
+    for (int i = 0; i < 7; ++i) {
+        people.push_back(Person(names[i], i, 0.0));
+    }
+
+    std::size_t before = mr.allocations;
+    people.sort_by_key(&Person::name);
+    EXPECT_EQ(mr.allocations, before + 2);
+
+    // Устойчивость: среди равных имен сохраняется исходный порядок
+    const char* expected[] = {"Alice", "Alice", "Bob", "Bob", "Carl", "Dan", "Eve"};
+    int expected_age[] = {2, 5, 1, 3, 6, 4, 0};
+    for (int i = 0; i < 7; ++i) {
+        EXPECT_EQ(people[i].name, expected[i]);
+        EXPECT_EQ(people[i].age, expected_age[i]);
+    }
+}
+
+TEST(SortTest, UniqueAfterSort) {
+    dynamic_array<int> arr;
+    for (int value : {4, 1, 4, 2, 1, 4, 3}) {
+        arr.push_back(value);
+    }
+    arr.sort();
+
+    EXPECT_EQ(arr.unique(), 3);
+    EXPECT_EQ(std::vector<int>(arr.begin(), arr.end()), std::vector<int>({1, 2, 3, 4}));
+}
+
+TEST(SortTest, BinarySearch) {
+    dynamic_array<int> arr;
+    for (int value : {9, 3, 7, 1, 5}) {
+        arr.push_back(value);
+    }
+    arr.sort();
+
+    EXPECT_TRUE(arr.binary_search(7));
+    EXPECT_FALSE(arr.binary_search(4));
+    EXPECT_EQ(*arr.lower_bound(4), 5);
+    EXPECT_EQ(arr.lower_bound(10), arr.end());
+}
+
+TEST(SortTest, BinarySearchByKey) {
+    dynamic_memory_resource mr;
+    dynamic_array<Person> people(&mr);
+    people.push_back(Person("Alice", 30, 50000.0));
+    people.push_back(Person("Bob", 25, 70000.0));
+    people.push_back(Person("Charlie", 35, 40000.0));
+    people.sort_by_key(&Person::age);
+
+    EXPECT_TRUE(people.binary_search_by_key(30, &Person::age));
+    EXPECT_FALSE(people.binary_search_by_key(31, &Person::age));
+    EXPECT_EQ(people.lower_bound_by_key(31, &Person::age)->name, "Charlie");
+}
+
 // Главная функция
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);